@@ -0,0 +1,424 @@
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file bench/combinatorics.cc
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Microbenchmarks combinate / permutate across n/k grids. Each case
+ * runs in its own child process. Prints one JSON object per case (as a JSON
+ * array) to stdout and progress to stderr.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <new>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "ccutl/algorithm.h"
+
+/* .--------------------------------------------------------------------------,
+	/                           allocation counting                            /
+ '--------------------------------------------------------------------------' */
+
+// every replaceable allocation function (scalar / array, aligned, nothrow) is
+// counted; every deallocation function releases with free
+
+namespace {
+std::atomic<size_t> n_allocations{0};
+
+/** @brief Counts an allocation and returns the memory (nullptr on failure).
+	 Alignments above the default one go through aligned_alloc. */
+void *counted_alloc(size_t sz, size_t align) noexcept {
+	n_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (sz == 0) sz = 1;
+	if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) return std::malloc(sz);
+	// aligned_alloc requires a size that is a multiple of the alignment
+	return std::aligned_alloc(align, (sz + align - 1) / align * align);
+}
+
+/** @brief counted_alloc that throws std::bad_alloc on failure. */
+void *counted_new(size_t sz, size_t align) {
+	if (void *p = counted_alloc(sz, align)) return p;
+	throw std::bad_alloc();
+}
+
+/** @brief Releases memory from counted_alloc. Kept out of line so that the
+	 compiler does not pair the free with the operator new that returned p. */
+[[gnu::noinline]] void counted_free(void *p) noexcept { std::free(p); }
+}	// namespace
+
+constexpr size_t default_align = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+void *operator new(size_t sz) { return counted_new(sz, default_align); }
+void *operator new[](size_t sz) { return counted_new(sz, default_align); }
+void *operator new(size_t sz, std::align_val_t align) {
+	return counted_new(sz, static_cast<size_t>(align));
+}
+void *operator new[](size_t sz, std::align_val_t align) {
+	return counted_new(sz, static_cast<size_t>(align));
+}
+void *operator new(size_t sz, const std::nothrow_t &) noexcept {
+	return counted_alloc(sz, default_align);
+}
+void *operator new[](size_t sz, const std::nothrow_t &) noexcept {
+	return counted_alloc(sz, default_align);
+}
+void *operator new(size_t sz, std::align_val_t align,
+									 const std::nothrow_t &) noexcept {
+	return counted_alloc(sz, static_cast<size_t>(align));
+}
+void *operator new[](size_t sz, std::align_val_t align,
+										 const std::nothrow_t &) noexcept {
+	return counted_alloc(sz, static_cast<size_t>(align));
+}
+
+void operator delete(void *p) noexcept { counted_free(p); }
+void operator delete[](void *p) noexcept { counted_free(p); }
+void operator delete(void *p, size_t) noexcept { counted_free(p); }
+void operator delete[](void *p, size_t) noexcept { counted_free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept {
+	counted_free(p);
+}
+void operator delete[](void *p, size_t, std::align_val_t) noexcept {
+	counted_free(p);
+}
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+	counted_free(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+	counted_free(p);
+}
+void operator delete(void *p, std::align_val_t,
+										 const std::nothrow_t &) noexcept {
+	counted_free(p);
+}
+void operator delete[](void *p, std::align_val_t,
+											 const std::nothrow_t &) noexcept {
+	counted_free(p);
+}
+
+namespace ccutl_bench {
+
+/* .--------------------------------------------------------------------------,
+	/                                 harness                                  /
+ '--------------------------------------------------------------------------' */
+
+/** @brief Minimum wall time spent repeating each case. */
+constexpr double min_seconds = 0.25;
+
+/** @brief Measurements of one case, sent back by the child that ran it. */
+struct case_result {
+	size_t n_results;
+	size_t n_runs;
+	double seconds;
+	size_t n_allocs;
+};
+
+/** @brief Runs a case until min_seconds have elapsed (at least once). */
+case_result measure(const std::function<size_t()> &run) {
+	using clock = std::chrono::steady_clock;
+
+	// the first run also measures allocations
+	size_t allocations_before = n_allocations.load();
+	auto start = clock::now();
+	size_t n_results = run();
+	double seconds = std::chrono::duration<double>(clock::now() - start).count();
+	size_t n_allocs = n_allocations.load() - allocations_before;
+
+	size_t n_runs = 1;
+	while (seconds < min_seconds) {
+		start = clock::now();
+		run();
+		seconds += std::chrono::duration<double>(clock::now() - start).count();
+		++n_runs;
+	}
+	return {n_results, n_runs, seconds, n_allocs};
+}
+
+/**
+ * @brief Runs a case in a forked child process and prints its results as a
+ * JSON object. The child's peak resident set size (which includes the few MiB
+ * of the harness itself) belongs to this case alone, unlike the process-wide
+ * high-water mark. Exits if the child fails.
+ *
+ * @param name Algorithm name
+ * @param n Target size
+ * @param k Sample size
+ * @param run Runs the algorithm once and returns the number of results
+ * @param first Whether or not this is the first case (no leading comma)
+ */
+void run_case(const std::string &name, size_t n, size_t k,
+							const std::function<size_t()> &run, bool first) {
+	int fds[2];
+	if (pipe(fds) != 0) {
+		std::perror("pipe");
+		std::exit(EXIT_FAILURE);
+	}
+	pid_t pid = fork();
+	if (pid < 0) {
+		std::perror("fork");
+		std::exit(EXIT_FAILURE);
+	}
+	if (pid == 0) {
+		// child: measure, send the result and exit without flushing stdout
+		close(fds[0]);
+		case_result result = measure(run);
+		bool sent = write(fds[1], &result, sizeof(result)) ==
+								static_cast<ssize_t>(sizeof(result));
+		_exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+	close(fds[1]);
+	case_result result{};
+	bool received = read(fds[0], &result, sizeof(result)) ==
+									static_cast<ssize_t>(sizeof(result));
+	close(fds[0]);
+	int status = 0;
+	rusage usage{};
+	wait4(pid, &status, 0, &usage);
+	if (!received || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+		std::cerr << name << " n=" << n << " k=" << k << ": failed\n";
+		std::exit(EXIT_FAILURE);
+	}
+
+	// each result holds k elements
+	double results_per_sec =
+			static_cast<double>(result.n_results * result.n_runs) / result.seconds;
+	double elements_per_sec = results_per_sec * static_cast<double>(k);
+	double allocs_per_result = static_cast<double>(result.n_allocs) /
+														 static_cast<double>(result.n_results);
+
+	std::cerr << name << " n=" << n << " k=" << k << ": " << elements_per_sec
+						<< " elements/s, " << allocs_per_result << " allocs/result, "
+						<< usage.ru_maxrss << " KiB peak\n";
+	std::printf(
+			"%s  {\"name\": \"%s\", \"n\": %zu, \"k\": %zu, \"results\": %zu, "
+			"\"runs\": %zu, \"results_per_sec\": %.1f, \"elements_per_sec\": "
+			"%.1f, \"allocs_per_result\": %.3f, \"peak_rss_kib\": %ld}",
+			first ? "" : ",\n", name.c_str(), n, k, result.n_results, result.n_runs,
+			results_per_sec, elements_per_sec, allocs_per_result, usage.ru_maxrss);
+}
+
+/* .--------------------------------------------------------------------------,
+	/                                  cases                                   /
+ '--------------------------------------------------------------------------' */
+
+struct grid_point {
+	size_t n;
+	size_t k;
+};
+
+std::vector<int> iota_vector(size_t n) {
+	std::vector<int> result(n);
+	std::iota(result.begin(), result.end(), 0);
+	return result;
+}
+
+/** @brief Copies the values at the set bits of mask to out, one ctz per bit. */
+void expand_mask_ctz(uint64_t mask, const int *values, int *out) {
+	for (; mask != 0; mask &= mask - 1) {
+		*out++ = values[__builtin_ctzll(mask)];
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/** @brief Copies the values at the set bits of mask to out, sixteen lanes per
+	 compress-store. values must hold 64 readable ints. */
+__attribute__((target("avx512f"))) void expand_mask_avx512(uint64_t mask,
+																													 const int *values,
+																													 int *out) {
+	for (int shift = 0; shift < 64 && (mask >> shift) != 0; shift += 16) {
+		auto lanes = static_cast<__mmask16>(mask >> shift);
+		_mm512_mask_compressstoreu_epi32(out, lanes,
+																		 _mm512_loadu_si512(values + shift));
+		out += __builtin_popcount(lanes);
+	}
+}
+#endif
+
+/** @brief Builds the same output as combinate from the combinate_mask kernel,
+	 expanding each mask into an exactly sized subresult. */
+template <typename TExpand>
+size_t combinate_masked(const std::vector<int> &padded, size_t n, size_t k,
+												const TExpand &expand) {
+	std::vector<std::vector<int>> result;
+	result.reserve(ccutl::n_combinations(n, k));
+	for (uint64_t mask : ccutl::combinate_mask(n, k)) {
+		std::vector<int> subresult(k);
+		expand(mask, padded.data(), subresult.data());
+		result.push_back(std::move(subresult));
+	}
+	return result.size();
+}
+
+}	// namespace ccutl_bench
+
+int main() {
+	using ccutl_bench::grid_point;
+	using ccutl_bench::iota_vector;
+	using ccutl_bench::run_case;
+
+	const std::vector<grid_point> combinate_grid{
+			{16, 4}, {16, 8}, {20, 10}, {32, 4}, {48, 3}, {80, 3}};
+	const std::vector<grid_point> permutate_grid{{8, 8}, {10, 5}, {12, 4}};
+	const std::vector<grid_point> repetition_grid{{4, 8}, {6, 6}, {10, 5}};
+	// subsets walks each size separately, so one size per case keeps the
+	// elements-per-result metric exact
+	const std::vector<grid_point> subsets_grid{{20, 10}, {40, 3}, {50, 4}};
+
+	bool first = true;
+	std::printf("[\n");
+
+	for (const auto &[n, k] : combinate_grid) {
+		const auto target = iota_vector(n);
+		const std::list<int> list_target(target.begin(), target.end());
+		run_case("combinate", n, k,
+						 [&, k = k] { return ccutl::combinate(target, k).size(); }, first);
+		first = false;
+		if (n <= 64) {
+			// the same output as combinate, expanded from the combinate_mask kernel
+			auto padded = target;
+			padded.resize(64);
+			run_case("combinate_mask", n, k,
+							 [&, n = n, k = k] {
+								 return ccutl_bench::combinate_masked(
+										 padded, n, k, ccutl_bench::expand_mask_ctz);
+							 },
+							 first);
+#if defined(__x86_64__) || defined(__i386__)
+			if (__builtin_cpu_supports("avx512f")) {
+				run_case("combinate_mask_avx512", n, k,
+								 [&, n = n, k = k] {
+									 return ccutl_bench::combinate_masked(
+											 padded, n, k, ccutl_bench::expand_mask_avx512);
+								 },
+								 first);
+			}
+#endif
+		}
+		run_case("combinate_list", n, k,
+						 [&, k = k] { return ccutl::combinate(list_target, k).size(); },
+						 first);
+		run_case("combinate_par", n, k,
+						 [&, k = k] {
+							 return ccutl::combinate(std::execution::par, target, k).size();
+						 },
+						 first);
+		run_case("combinate_flat", n, k,
+						 [&, k = k] { return ccutl::combinate_flat(target, k).size(); },
+						 first);
+		run_case("lazy_combinate", n, k,
+						 [&, k = k] {
+							 size_t n_results = 0;
+							 for (const auto &sample : ccutl::lazy_combinate(target, k)) {
+								 n_results += sample.size() != 0;
+							 }
+							 return n_results;
+						 },
+						 first);
+	}
+
+	for (bool repetition : {false, true}) {
+		const std::string suffix = repetition ? "_repetition" : "";
+		for (const auto &[n, k] : repetition ? repetition_grid : permutate_grid) {
+			const auto target = iota_vector(n);
+			run_case("permutate" + suffix, n, k,
+							 [&, k = k] {
+								 return ccutl::permutate(target, k, repetition).size();
+							 },
+							 first);
+			run_case("permutate_par" + suffix, n, k,
+							 [&, k = k] {
+								 return ccutl::permutate(std::execution::par, target, k,
+																				 repetition)
+										 .size();
+							 },
+							 first);
+			run_case("permutate_flat" + suffix, n, k,
+							 [&, k = k] {
+								 return ccutl::permutate_flat(target, k, repetition).size();
+							 },
+							 first);
+			run_case("lazy_permutate" + suffix, n, k,
+							 [&, k = k] {
+								 size_t n_results = 0;
+								 for (const auto &sample :
+											ccutl::lazy_permutate(target, k, repetition)) {
+									 n_results += sample.size() != 0;
+								 }
+								 return n_results;
+							 },
+							 first);
+		}
+	}
+
+	for (const auto &[n, k] : subsets_grid) {
+		const auto target = iota_vector(n);
+		run_case("subsets", n, k,
+						 [&, k = k] {
+							 size_t n_results = 0;
+							 for (const auto &sample : ccutl::subsets(target, k, k)) {
+								 n_results += sample.size() != 0;
+							 }
+							 return n_results;
+						 },
+						 first);
+		// the same sample_views, expanded from the subsets_mask kernel
+		run_case("subsets_mask", n, k,
+						 [&, n = n, k = k] {
+							 using TargetCit = std::vector<int>::const_iterator;
+							 std::vector<TargetCit> sample(k);
+							 size_t n_results = 0;
+							 for (uint64_t mask : ccutl::subsets_mask(n, k, k)) {
+								 size_t sz = 0;
+								 for (; mask != 0; mask &= mask - 1) {
+									 sample[sz++] = target.cbegin() + __builtin_ctzll(mask);
+								 }
+								 ccutl::sample_view<TargetCit> view(sample.data(),
+																										sample.data() + sz);
+								 n_results += view.size() != 0;
+							 }
+							 return n_results;
+						 },
+						 first);
+	}
+
+	std::printf("\n]\n");
+	return 0;
+}
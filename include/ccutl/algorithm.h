@@ -22,30 +22,224 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-06-28
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
 #include "ccutl/core/algorithm.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <execution>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "ccutl/convert.h"
+#include "ccutl/executor.h"
+#include "ccutl/limits.h"
+#include "ccutl/math.h"
+#include "ccutl/simd.h"
 #include "ccutl/type_traits.h"
 
 namespace ccutl {
 
+/* .--------------------------------------------------------------------------,
+	/                                ccutl::zip                                /
+ '--------------------------------------------------------------------------' */
+
+template <typename... TContainers>
+/** @brief References several containers so that the N-ary transform_it and
+	 iterate_it can walk them in lockstep. Walks stop at the end of the shortest
+	 container. */
+class zip_view {
+	static_assert(sizeof...(TContainers) > 0, "zip needs a container");
+
+ public:
+	explicit zip_view(const TContainers &... containers)
+			: containers_(&containers...) {}
+
+	/** @brief Returns the size of the shortest container. */
+	size_t size() const {
+		return std::apply(
+				[](const auto *... containers) {
+					return std::min({static_cast<size_t>(std::distance(
+							containers->cbegin(), containers->cend()))...});
+				},
+				containers_);
+	}
+
+	const std::tuple<const TContainers *...> &containers() const {
+		return containers_;
+	}
+
+	template <bool Reverse = false>
+	/** @brief Returns a tuple of iterators to element i of every container
+		 (counting from the back if Reverse). */
+	auto iterators(size_t i = 0) const {
+		auto offset = static_cast<std::ptrdiff_t>(i);
+		return std::apply(
+				[&](const auto *... containers) {
+					if constexpr (Reverse) {
+						return std::make_tuple(std::next(containers->crbegin(), offset)...);
+					} else {
+						return std::make_tuple(std::next(containers->cbegin(), offset)...);
+					}
+				},
+				containers_);
+	}
+
+ private:
+	std::tuple<const TContainers *...> containers_;
+};
+
+template <typename... TContainers,
+					std::enable_if_t<are_const_iterable_v<TContainers...>> *>
+/**
+ * @brief Zips containers for the N-ary transform_it and iterate_it. The
+ * containers are referenced, not copied.
+ *
+ * @param containers Containers to walk in lockstep
+ * @return zip_view<TContainers...>
+ */
+zip_view<TContainers...> zip(const TContainers &... containers) {
+	return zip_view<TContainers...>(containers...);
+}
+
 /* .--------------------------------------------------------------------------,
 	/                           ccutl::transform_it                            /
  '--------------------------------------------------------------------------' */
 
+namespace internal {
+
+template <typename T>
+/** @brief Whether or not the const iterators of a container T are random
+	 access. */
+constexpr bool has_random_access_ = std::is_base_of_v<
+		std::random_access_iterator_tag,
+		typename std::iterator_traits<typename T::const_iterator>::iterator_category>;
+
+template <typename TExecutionPolicy>
+/** @brief Returns the number of chunks that for_each_chunk_ splits n_total
+	 indices into (a few per hardware thread, or per pool worker). */
+size_t n_chunks_(const TExecutionPolicy &policy, size_t n_total) {
+	if constexpr (is_pool_policy_v<TExecutionPolicy>) {
+		return policy.get().n_chunks(n_total);
+	} else {
+		size_t n_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+		return std::min(n_total, n_threads * 4);
+	}
+}
+
+template <typename TExecutionPolicy, typename TChunkOp>
+/** @brief Splits the index space [0, n_total) into n_chunks_ contiguous chunks
+	 and calls f(first, last) for each chunk using the given execution policy
+	 (or pool). */
+void for_each_chunk_(TExecutionPolicy &&policy, size_t n_total,
+										 const TChunkOp &f) {
+	if constexpr (is_pool_policy_v<TExecutionPolicy>) {
+		policy.get().parallel_for(n_total, f);
+	} else {
+		if (n_total == 0) return;
+		size_t n_chunks = n_chunks_(policy, n_total);
+		size_t chunk_sz = n_total / n_chunks;
+		size_t n_larger = n_total % n_chunks;
+		std::vector<size_t> chunks(n_chunks);
+		std::iota(chunks.begin(), chunks.end(), 0);
+		std::for_each(policy, chunks.begin(), chunks.end(), [&](size_t i) {
+			// the first n_larger chunks take one extra index
+			size_t first = i * chunk_sz + std::min(i, n_larger);
+			f(first, first + chunk_sz + (i < n_larger ? 1 : 0));
+		});
+	}
+}
+
+template <bool BackInsert, typename TOutputContainer>
+/** @brief Returns the index of the first output slot that transform_it writes
+	 to. With BackInsert the output is first grown by n slots. */
+size_t append_slots_(TOutputContainer *output, size_t n) {
+	if constexpr (BackInsert) {
+		size_t n_prev = output->size();
+		output->resize(n_prev + n);
+		return n_prev;
+	} else {
+		return 0;
+	}
+}
+
+template <typename TContainer>
+/** @brief Returns the number of elements of an iterable container. */
+size_t n_elements_(const TContainer &container) {
+	return static_cast<size_t>(
+			std::distance(container.cbegin(), container.cend()));
+}
+
+/** @brief Whether transform_it can run f over the data() of the containers
+	 with the SIMD kernels of ccutl/simd.h. */
+template <typename TOp, typename TOutputContainer,
+					typename... TInputContainers>
+inline constexpr bool simd_transform_it_ = ([]() constexpr->bool {
+	if constexpr (is_contiguous_<TOutputContainer> &&
+								(is_contiguous_<TInputContainers> && ...)) {
+		return simd_transformable_<TOp, typename TOutputContainer::value_type,
+															 typename TInputContainers::value_type...>;
+	}
+	return false;
+})();
+
+template <typename TOutputContainer, typename TInputContainer,
+					typename TUnaryOp>
+/** @brief Transforms the input elements [first, last) into the output slots
+	 [offset + first, offset + last), using the SIMD kernels when possible. */
+void transform_slots_(TOutputContainer *output, size_t offset, size_t first,
+											size_t last, const TInputContainer &input,
+											const TUnaryOp &f) {
+	if constexpr (simd_transform_it_<TUnaryOp, TOutputContainer,
+																	 TInputContainer>) {
+		simd_transform_(last - first, as_simd_op_(f),
+										output->data() + offset + first, input.data() + first);
+	} else {
+		std::transform(std::next(input.cbegin(), static_cast<std::ptrdiff_t>(first)),
+									 std::next(input.cbegin(), static_cast<std::ptrdiff_t>(last)),
+									 std::next(output->begin(),
+														 static_cast<std::ptrdiff_t>(offset + first)),
+									 f);
+	}
+}
+
+template <typename TOutputContainer, typename TInputContainer1,
+					typename TInputContainer2, typename TBinaryOp>
+/** @brief Binary version of the above. */
+void transform_slots_(TOutputContainer *output, size_t offset, size_t first,
+											size_t last, const TInputContainer1 &input1,
+											const TInputContainer2 &input2, const TBinaryOp &f) {
+	if constexpr (simd_transform_it_<TBinaryOp, TOutputContainer,
+																	 TInputContainer1, TInputContainer2>) {
+		simd_transform_(last - first, as_simd_op_(f),
+										output->data() + offset + first, input1.data() + first,
+										input2.data() + first);
+	} else {
+		std::transform(
+				std::next(input1.cbegin(), static_cast<std::ptrdiff_t>(first)),
+				std::next(input1.cbegin(), static_cast<std::ptrdiff_t>(last)),
+				std::next(input2.cbegin(), static_cast<std::ptrdiff_t>(first)),
+				std::next(output->begin(), static_cast<std::ptrdiff_t>(offset + first)),
+				f);
+	}
+}
+
+}	// namespace internal
+
 template <bool BackInsert, typename TInputContainer, typename TOutputContainer,
 					typename TUnaryOp,
 					std::enable_if_t<are_const_iterable_v<TInputContainer> &&
@@ -53,7 +247,17 @@ template <bool BackInsert, typename TInputContainer, typename TOutputContainer,
 auto transform_it(const TInputContainer &input, TOutputContainer *output,
 									const TUnaryOp &f) {
 	using std::transform;
-	if constexpr (BackInsert) {
+	if constexpr (internal::simd_transform_it_<TUnaryOp, TOutputContainer,
+																						 TInputContainer>) {
+		size_t n = internal::n_elements_(input);
+		size_t offset = internal::append_slots_<BackInsert>(output, n);
+		internal::transform_slots_(output, offset, 0, n, input, f);
+		if constexpr (BackInsert) {
+			return std::back_insert_iterator(*output);
+		} else {
+			return std::next(output->begin(), static_cast<std::ptrdiff_t>(n));
+		}
+	} else if constexpr (BackInsert) {
 		return transform(input.cbegin(), input.cend(),
 										 std::back_insert_iterator(*output), f);
 	} else {
@@ -64,18 +268,22 @@ auto transform_it(const TInputContainer &input, TOutputContainer *output,
 template <bool BackInsert, typename TExecutionPolicy, typename TInputContainer,
 					typename TOutputContainer, typename TUnaryOp,
 					std::enable_if_t<
-							std::is_execution_policy_v<decay_deep_t<TExecutionPolicy>> &&
+							is_parallel_policy_v<TExecutionPolicy> &&
 							are_const_iterable_v<TInputContainer> &&
 							are_iterable_v<TOutputContainer>> *>
-auto transform_it(const TExecutionPolicy &&policy, const TInputContainer &input,
+auto transform_it(TExecutionPolicy &&policy, const TInputContainer &input,
 									TOutputContainer *output, const TUnaryOp &f) {
-	if constexpr (BackInsert) {
-		return std::transform(policy, input.cbegin(), input.cend(),
-													std::back_insert_iterator(*output), f);
-
+	size_t n = internal::n_elements_(input);
+	size_t offset = internal::append_slots_<BackInsert>(output, n);
+	if constexpr (is_pool_policy_v<TExecutionPolicy>) {
+		policy.get().parallel_for(n, [&](size_t first, size_t last) {
+			internal::transform_slots_(output, offset, first, last, input, f);
+		});
+		return std::next(output->begin(), static_cast<std::ptrdiff_t>(offset + n));
 	} else {
-		return std::transform(policy, input.cbegin(), input.cend(), output->begin(),
-													f);
+		return std::transform(
+				policy, input.cbegin(), input.cend(),
+				std::next(output->begin(), static_cast<std::ptrdiff_t>(offset)), f);
 	}
 }
 
@@ -87,7 +295,18 @@ template <
 auto transform_it(const TInputContainer1 &input1,
 									const TInputContainer2 &input2, TOutputContainer *output,
 									const TBinaryOp &f) {
-	if constexpr (BackInsert) {
+	if constexpr (internal::simd_transform_it_<TBinaryOp, TOutputContainer,
+																						 TInputContainer1,
+																						 TInputContainer2>) {
+		size_t n = internal::n_elements_(input1);
+		size_t offset = internal::append_slots_<BackInsert>(output, n);
+		internal::transform_slots_(output, offset, 0, n, input1, input2, f);
+		if constexpr (BackInsert) {
+			return std::back_insert_iterator(*output);
+		} else {
+			return std::next(output->begin(), static_cast<std::ptrdiff_t>(n));
+		}
+	} else if constexpr (BackInsert) {
 		return std::transform(input1.cbegin(), input1.cend(), input2.cbegin(),
 													std::back_insert_iterator(*output), f);
 	} else {
@@ -100,23 +319,115 @@ template <bool BackInsert, typename TExecutionPolicy, typename TInputContainer1,
 					typename TInputContainer2, typename TOutputContainer,
 					typename TUnaryOp,
 					std::enable_if_t<
-							std::is_execution_policy_v<decay_deep_t<TExecutionPolicy>> &&
+							is_parallel_policy_v<TExecutionPolicy> &&
 							are_const_iterable_v<TInputContainer1, TInputContainer2> &&
 							are_iterable_v<TOutputContainer>> *>
-auto transform_it(const TExecutionPolicy &&policy,
-									const TInputContainer1 &input1,
+auto transform_it(TExecutionPolicy &&policy, const TInputContainer1 &input1,
 									const TInputContainer2 &input2, TOutputContainer *output,
 									const TUnaryOp &f) {
+	size_t n = internal::n_elements_(input1);
+	size_t offset = internal::append_slots_<BackInsert>(output, n);
+	if constexpr (is_pool_policy_v<TExecutionPolicy>) {
+		policy.get().parallel_for(n, [&](size_t first, size_t last) {
+			internal::transform_slots_(output, offset, first, last, input1, input2,
+																 f);
+		});
+		return std::next(output->begin(), static_cast<std::ptrdiff_t>(offset + n));
+	} else {
+		return std::transform(
+				policy, input1.cbegin(), input1.cend(), input2.cbegin(),
+				std::next(output->begin(), static_cast<std::ptrdiff_t>(offset)), f);
+	}
+}
+
+namespace internal {
+
+template <typename TNaryOp, typename TOutput, typename... TInputs>
+/** @brief Calls f with element i of every input for i in [0, n). Indexing raw
+	 pointers keeps the loop vectorizable for any inlinable f. */
+void zip_loop_(size_t n, const TNaryOp &f, TOutput *out, const TInputs *... in) {
+	for (size_t i = 0; i < n; ++i) out[i] = f(in[i]...);
+}
+
+template <typename TOutputContainer, typename TNaryOp,
+					typename... TInputContainers>
+/** @brief Transforms the zipped elements [first, last) into the output slots
+	 [offset + first, offset + last): with the SIMD kernels for known
+	 operations, over raw pointers for other contiguous containers, and with
+	 lockstep iterators otherwise. */
+void zip_transform_slots_(TOutputContainer *output, size_t offset,
+													size_t first, size_t last,
+													const zip_view<TInputContainers...> &inputs,
+													const TNaryOp &f) {
+	if constexpr (simd_transform_it_<TNaryOp, TOutputContainer,
+																	 TInputContainers...>) {
+		std::apply(
+				[&](const auto *... containers) {
+					simd_transform_(last - first, as_simd_op_(f),
+													output->data() + offset + first,
+													(containers->data() + first)...);
+				},
+				inputs.containers());
+	} else if constexpr (is_contiguous_<TOutputContainer> &&
+											 (is_contiguous_<TInputContainers> && ...)) {
+		std::apply(
+				[&](const auto *... containers) {
+					zip_loop_(last - first, f, output->data() + offset + first,
+										(containers->data() + first)...);
+				},
+				inputs.containers());
+	} else {
+		auto out =
+				std::next(output->begin(), static_cast<std::ptrdiff_t>(offset + first));
+		auto its = inputs.iterators(first);
+		for (size_t i = first; i < last; ++i, ++out) {
+			std::apply(
+					[&](auto &... it) {
+						*out = f(*it...);
+						(++it, ...);
+					},
+					its);
+		}
+	}
+}
+
+}	// namespace internal
+
+template <bool BackInsert, typename... TInputContainers,
+					typename TOutputContainer, typename TNaryOp,
+					std::enable_if_t<are_iterable_v<TOutputContainer>> *>
+/** @brief Calls f with the elements of every zipped container in lockstep and
+	 writes the results to the output (appends them with BackInsert). */
+auto transform_it(const zip_view<TInputContainers...> &inputs,
+									TOutputContainer *output, const TNaryOp &f) {
+	size_t n = inputs.size();
+	size_t offset = internal::append_slots_<BackInsert>(output, n);
+	internal::zip_transform_slots_(output, offset, 0, n, inputs, f);
 	if constexpr (BackInsert) {
-		return std::transform(policy, input1.cbegin(), input1.cend(),
-													input2.cbegin(), std::back_insert_iterator(*output),
-													f);
+		return std::back_insert_iterator(*output);
 	} else {
-		return std::transform(policy, input1.cbegin(), input1.cend(),
-													input2.cbegin(), output->begin(), f);
+		return std::next(output->begin(), static_cast<std::ptrdiff_t>(n));
 	}
 }
 
+template <bool BackInsert, typename TExecutionPolicy,
+					typename... TInputContainers, typename TOutputContainer,
+					typename TNaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy> &&
+													 are_iterable_v<TOutputContainer>> *>
+/** @brief Same as above, but transforms chunks of elements using an execution
+	 policy; returns the end of the written slots. */
+auto transform_it(TExecutionPolicy &&policy,
+									const zip_view<TInputContainers...> &inputs,
+									TOutputContainer *output, const TNaryOp &f) {
+	size_t n = inputs.size();
+	size_t offset = internal::append_slots_<BackInsert>(output, n);
+	internal::for_each_chunk_(policy, n, [&](size_t first, size_t last) {
+		internal::zip_transform_slots_(output, offset, first, last, inputs, f);
+	});
+	return std::next(output->begin(), static_cast<std::ptrdiff_t>(offset + n));
+}
+
 /* .--------------------------------------------------------------------------,
 	/                            ccutl::for_each_it                            /
  '--------------------------------------------------------------------------' */
@@ -127,14 +438,45 @@ TUnaryOp for_each_it(const TInputContainer &input, const TUnaryOp &f) {
 	return std::for_each(input.cbegin(), input.cend(), f);
 }
 
-template <typename TExecutionPolicy, typename TInputContainer, typename T,
+template <typename TExecutionPolicy, typename TInputContainer,
 					typename TUnaryOp,
 					std::enable_if_t<
-							std::is_execution_policy_v<decay_deep_t<TExecutionPolicy>> &&
+							is_parallel_policy_v<TExecutionPolicy> &&
 							are_const_iterable_v<TInputContainer>> *>
-void for_each_it(const TExecutionPolicy &&policy, const TInputContainer &input,
+void for_each_it(TExecutionPolicy &&policy, const TInputContainer &input,
 								 const TUnaryOp &f) {
-	std::for_each(policy, input.cbegin(), input.cend(), f);
+	if constexpr (is_pool_policy_v<TExecutionPolicy>) {
+		auto &pool = policy.get();
+		size_t n = static_cast<size_t>(std::distance(input.cbegin(), input.cend()));
+		if constexpr (internal::has_random_access_<TInputContainer>) {
+			pool.parallel_for(n, [&](size_t first, size_t last) {
+				std::for_each(std::next(input.cbegin(), static_cast<std::ptrdiff_t>(first)),
+											std::next(input.cbegin(), static_cast<std::ptrdiff_t>(last)),
+											f);
+			});
+		} else {
+			// walks the input once for the bounds of the chunks that parallel_for
+			// would make, then runs one chunk per index
+			size_t n_chunks = pool.n_chunks(n);
+			size_t chunk_sz = n_chunks == 0 ? 0 : n / n_chunks;
+			size_t n_larger = n_chunks == 0 ? 0 : n % n_chunks;
+			std::vector<decltype(input.cbegin())> bounds;
+			bounds.reserve(n_chunks + 1);
+			bounds.push_back(input.cbegin());
+			for (size_t i = 0; i < n_chunks; ++i) {
+				bounds.push_back(std::next(
+						bounds.back(),
+						static_cast<std::ptrdiff_t>(chunk_sz + (i < n_larger ? 1 : 0))));
+			}
+			pool.parallel_for(n_chunks, [&](size_t first, size_t last) {
+				for (size_t i = first; i < last; ++i) {
+					std::for_each(bounds[i], bounds[i + 1], f);
+				}
+			});
+		}
+	} else {
+		std::for_each(policy, input.cbegin(), input.cend(), f);
+	}
 }
 
 /* .--------------------------------------------------------------------------,
@@ -543,6 +885,44 @@ void iterate_it(const TInputContainer1 &input1, const TInputContainer2 &input2,
 	}
 }
 
+/*                                   n-ary                                   */
+
+template <bool Reverse, typename... TInputContainers, typename TNaryOp>
+/** @brief Calls f(it1, it2, ...) with the iterators of every zipped container
+	 in lockstep (from the back if Reverse). */
+void iterate_it(const zip_view<TInputContainers...> &inputs, const TNaryOp &f) {
+	auto its = inputs.template iterators<Reverse>();
+	for (size_t i = 0, n = inputs.size(); i < n; ++i) {
+		std::apply(
+				[&](auto &... it) {
+					f(std::as_const(it)...);
+					(++it, ...);
+				},
+				its);
+	}
+}
+
+template <typename TExecutionPolicy, typename... TInputContainers,
+					typename TNaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy>> *>
+/** @brief Same as above (forward only), but iterates chunks of elements using
+	 an execution policy. */
+void iterate_it(TExecutionPolicy &&policy,
+								const zip_view<TInputContainers...> &inputs, const TNaryOp &f) {
+	internal::for_each_chunk_(policy, inputs.size(),
+														[&](size_t first, size_t last) {
+															auto its = inputs.iterators(first);
+															for (size_t i = first; i < last; ++i) {
+																std::apply(
+																		[&](auto &... it) {
+																			f(std::as_const(it)...);
+																			(++it, ...);
+																		},
+																		its);
+															}
+														});
+}
+
 /* .--------------------------------------------------------------------------,
 	/                              ccutl::concat                               /
  '--------------------------------------------------------------------------' */
@@ -613,189 +993,2763 @@ std::string join(const TContain<TVal> &target, const TDelim &delimiter) {
 }
 
 /* .--------------------------------------------------------------------------,
-	/                             ccutl::combinate                             /
+	/                  ccutl::n_combinations / n_permutations                  /
  '--------------------------------------------------------------------------' */
 
-template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
-/** @brief Finds all possible combinations of the values in a container T and
-	 returns the result as a vector<T>. */
-std::vector<T> combinate(const T &target, size_t sample_sz) {
-	/*                            Local Typenames                            */
-	using std::back_insert_iterator;
-	using std::next;
-	using std::prev;
-	using std::transform;
-	using std::vector;
-	using TargetCit = typename T::const_iterator;
-	using SampleRit = typename vector<TargetCit>::reverse_iterator;
-	/*                                                                       */
+namespace internal {
+
+/** @brief Stores C(n_avail, sample_sz) in result, or returns false if it does
+	 not fit in a size_t. An overflow shows within 64 iterations, as C(n, i)
+	 is at least 2^i for i <= n / 2. */
+inline constexpr bool n_combinations_(size_t n_avail, size_t sample_sz,
+																			size_t *result) {
+	*result = 0;
+	if (sample_sz > n_avail) return true;
+	if (sample_sz > n_avail - sample_sz) sample_sz = n_avail - sample_sz;
+	*result = 1;
+	for (size_t i = 0; i < sample_sz; ++i) {
+		// result * (n_avail - i) is divisible by (i + 1); divide out the common
+		// factor first so that the product only overflows if C(n_avail, i + 1)
+		// does
+		size_t divisor = i + 1;
+		size_t common = std::gcd(*result, divisor);
+		*result /= common;
+		divisor /= common;
+		if (is_mul_overflow<size_t>(*result, (n_avail - i) / divisor)) {
+			return false;
+		}
+		*result *= (n_avail - i) / divisor;
+	}
+	return true;
+}
 
-	// check base cases / assertions
-	size_t n_avail = target.size();
-	if (sample_sz == n_avail) return {target};
-	assert(sample_sz > 0 && sample_sz < n_avail);
+/** @brief Returns binomial * factor / n for binomial = C(n, r), where the
+	 quotient is a smaller binomial coefficient (and so exact): factor n - r
+	 gives C(n - 1, r), factor r gives C(n - 1, r - 1). O(1); the common factor
+	 of binomial and n is divided out first so that nothing overflows. */
+inline size_t binomial_step_(size_t binomial, size_t n, size_t factor) {
+	size_t common = std::gcd(binomial, n);
+	return binomial / common * (factor / (n / common));
+}
 
-	//                Result goes here
-	vector<T> result;
-	//                ----------------
+}	// namespace internal
 
-	// current target iterator sample
-	vector<TargetCit> sample(sample_sz);
-	{
-		// create ascending iterator sample
-		TargetCit base_cit = target.cbegin();
-		transform(sample.begin(), sample.end(), sample.begin(),
-							[&]([[maybe_unused]] const auto &v) { return base_cit++; });
-	}
-
-	// beginning of sample iterator
-	SampleRit s_rbegin = sample.rbegin();
-	// end of sample iterator
-	SampleRit s_rend = sample.rend();
-	// current sample iterator
-	SampleRit scur = s_rbegin;
-	// current last position for target iterator (decreases with scur increase)
-	TargetCit tlim = prev(target.cend());
-
-	// perform logic until done
-	while (true) {
-		// Update result vector
-		{
-			// create subresult
-			T subresult;
-			// fill subresult with iterator endpoints
-			transform(sample.begin(), sample.end(), back_insert_iterator(subresult),
-								[](const auto &it) { return *it; });
-			// store the subresult in the results
-			result.push_back(subresult);
-		}
-
-		if (*scur != tlim) {
-			++*scur;
-		} else {
-			while (*scur == tlim) {
-				++scur;
-				--tlim;
-				if (scur == s_rend) {
-					return result;
-				}
-			}
+/**
+ * @brief Returns the number of combinations C(n_avail, sample_sz), i.e. the
+ * size of the output of combinate. Throws "EOverflow" if the count does not
+ * fit in a size_t. Usable in constant expressions.
+ *
+ * @param n_avail Target size
+ * @param sample_sz Sample size
+ * @return constexpr size_t
+ */
+inline constexpr size_t n_combinations(size_t n_avail, size_t sample_sz) {
+	size_t result = 0;
+	if (!internal::n_combinations_(n_avail, sample_sz, &result)) throw "EOverflow";
+	return result;
+}
 
-			TargetCit tnext = next(*scur);
+/**
+ * @brief Returns the number of permutations, i.e. the size of the output of
+ * permutate: P(n_avail, sample_sz) without repetition or n_avail^sample_sz with
+ * repetition. Throws "EOverflow" if the count does not fit in a size_t. Usable
+ * in constant expressions.
+ *
+ * @param n_avail Target size
+ * @param sample_sz Sample size (sz of 0 uses n_avail)
+ * @param repetition Whether or not repetition is allowed
+ * @return constexpr size_t
+ */
+inline constexpr size_t n_permutations(size_t n_avail, size_t sample_sz,
+																			 bool repetition) {
+	// handle default value
+	if (sample_sz == 0) sample_sz = n_avail;
+	if (!repetition && sample_sz > n_avail) return 0;
+	size_t result = 1;
+	for (size_t i = 0; i < sample_sz; ++i) {
+		safe_mul(&result, repetition ? n_avail : n_avail - i);
+	}
+	return result;
+}
 
-			while (*scur != tnext) {
-				*scur = tnext;
-				if (scur != s_rbegin) {
-					--scur;
-					++tlim;
-					++tnext;
-				}
-			}
+namespace internal {
+
+/** @brief Returns the index of the lowest set bit of a non-zero mask. */
+inline size_t mask_lowest_(uint64_t mask) {
+	return static_cast<size_t>(__builtin_ctzll(mask));
+}
+
+/** @brief Returns the index of the highest set bit of a non-zero mask. */
+inline size_t mask_highest_(uint64_t mask) {
+	return 63 - static_cast<size_t>(__builtin_clzll(mask));
+}
+
+/** @brief Returns a mask with the lowest n bits set (n <= 64). */
+inline uint64_t mask_fill_(size_t n) {
+	return n >= 64 ? ~uint64_t{0} : (uint64_t{1} << n) - 1;
+}
+
+template <typename TRange, typename TUnaryOp>
+/** @brief Calls f with each sample of an enumeration range. Stops early (and
+	 returns false) if f returns false. */
+bool for_each_sample_(const TRange &range, const TUnaryOp &f) {
+	for (const auto &sample : range) {
+		if constexpr (std::is_void_v<
+											functor_return_type_t<const TUnaryOp &, decltype(sample)>>) {
+			f(sample);
+		} else {
+			if (!f(sample)) return false;
 		}
 	}
+	return true;
 }
 
-/* .--------------------------------------------------------------------------,
-	/                             ccutl::permutate                             /
- '--------------------------------------------------------------------------' */
+template <typename TValue>
+/** @brief Snapshot element referring to a value that is not trivially
+	 copyable. */
+struct element_ref_ {
+	const TValue *ptr;
+};
+
+template <typename TValue>
+/** @brief Returns the target value of a target or snapshot element. */
+const TValue &element_value_(const TValue &element) {
+	return element;
+}
 
-template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
-/** @brief Finds all possible permutations of the values in a container T and
-	 returns the result as a vector<T>. Optionally allows for value repetition.
+template <typename TValue>
+/** @brief Returns the target value of a target or snapshot element. */
+const TValue &element_value_(const element_ref_<TValue> &element) {
+	return *element.ptr;
+}
+
+template <typename T>
+/**
+ * @brief Copies the elements of a (node-based) container into a contiguous
+ * vector so that enumeration can step indices instead of chasing nodes:
+ * trivially copyable values are copied, others are referred to by pointer.
+ *
+ * @param target Target container (must outlive the snapshot)
+ * @return std::vector<typename T::value_type> or
+ *         std::vector<element_ref_<typename T::value_type>>
  */
+auto snapshot_(const T &target) {
+	using TValue = typename T::value_type;
+	if constexpr (std::is_trivially_copyable_v<TValue>) {
+		return std::vector<TValue>(target.cbegin(), target.cend());
+	} else {
+		std::vector<element_ref_<TValue>> snapshot;
+		snapshot.reserve(target.size());
+		for (const auto &value : target) snapshot.push_back({&value});
+		return snapshot;
+	}
+}
+
+/** @brief Whether a container T can reserve storage up front. */
+template <typename T, typename = void>
+inline constexpr bool has_reserve_ = false;
+
+template <typename T>
+inline constexpr bool has_reserve_<
+		T, std::void_t<decltype(std::declval<T &>().reserve(size_t{}))>> = true;
+
+template <typename T, typename TSample>
+/** @brief Creates a T from a sample of target or snapshot elements. The
+	 subresult is sized once: growing it value by value reallocates about
+	 log2(sample size) times, which costs more than the enumeration itself. */
+T make_subresult_(const TSample &sample) {
+	T subresult;
+	if constexpr (has_reserve_<T>) {
+		subresult.reserve(
+				static_cast<size_t>(std::distance(sample.begin(), sample.end())));
+	}
+	std::back_insert_iterator out(subresult);
+	for (const auto &element : sample) *out++ = element_value_(element);
+	return subresult;
+}
+
+/** @brief Identifies the enumeration a checkpoint blob belongs to. */
+enum class checkpoint_kind_ : uint8_t {
+	combination = 1,
+	permutation = 2,
+	permutation_repetition = 3
+};
+
+/** @brief Appends an unsigned LEB128 varint to a checkpoint blob. */
+inline void put_varint_(std::vector<uint8_t> *blob, size_t value) {
+	for (; value >= 0x80; value >>= 7) {
+		blob->push_back(static_cast<uint8_t>(value | 0x80));
+	}
+	blob->push_back(static_cast<uint8_t>(value));
+}
+
+/** @brief Reads an unsigned LEB128 varint from a checkpoint blob and advances
+	 the offset past it. Throws "ECheckpoint" if the varint is truncated. */
+inline size_t get_varint_(const std::vector<uint8_t> &blob, size_t *offset) {
+	size_t value = 0;
+	for (size_t shift = 0; shift < 64; shift += 7) {
+		if (*offset == blob.size()) break;
+		uint8_t byte = blob[(*offset)++];
+		value |= static_cast<size_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) return value;
+	}
+	throw "ECheckpoint";
+}
+
 /**
- * @brief Finds all possible permutations of the values in a container T and
- * returns the result as a vector<T>. Optionally allows for value repetition.
+ * @brief Serializes the state of an enumeration to a byte blob: its kind, the
+ * target and sample sizes and the current target positions (absent once the
+ * enumeration is done), all as varints. Combination positions are ascending
+ * and stored as deltas, which keeps them to a byte each for most targets.
  *
- * @param target Target container
- * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
- * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
- * @return std::vector<T>
+ * @param kind Enumeration kind
+ * @param n_avail Target size
+ * @param sample_sz Sample size
+ * @param positions Current target positions (nullptr if done)
+ * @return std::vector<uint8_t>
  */
-std::vector<T> permutate(const T &target, size_t sample_sz, bool repetition) {
-	/*                            Local Typenames                            */
-	using std::back_insert_iterator;
-	using std::fill;
-	using std::next;
-	using std::prev;
-	using std::transform;
-	using std::vector;
+inline std::vector<uint8_t> save_checkpoint_(
+		checkpoint_kind_ kind, size_t n_avail, size_t sample_sz,
+		const std::vector<size_t> *positions) {
+	std::vector<uint8_t> blob{static_cast<uint8_t>(kind),
+														static_cast<uint8_t>(positions != nullptr)};
+	put_varint_(&blob, n_avail);
+	put_varint_(&blob, sample_sz);
+	if (positions != nullptr) {
+		size_t previous = 0;
+		for (size_t position : *positions) {
+			if (kind == checkpoint_kind_::combination) {
+				put_varint_(&blob, position - previous);
+				previous = position;
+			} else {
+				put_varint_(&blob, position);
+			}
+		}
+	}
+	return blob;
+}
+
+/**
+ * @brief Restores the target positions saved by save_checkpoint_. Throws
+ * "ECheckpoint" if the blob is malformed or belongs to a different kind of
+ * enumeration, target size or sample size.
+ *
+ * @param blob Checkpoint blob
+ * @param kind Expected enumeration kind
+ * @param n_avail Expected target size
+ * @param sample_sz Expected sample size
+ * @param positions Receives the target positions
+ * @return false if the enumeration was done
+ */
+inline bool load_checkpoint_(const std::vector<uint8_t> &blob,
+														 checkpoint_kind_ kind, size_t n_avail,
+														 size_t sample_sz, std::vector<size_t> *positions) {
+	if (blob.size() < 2 || blob[0] != static_cast<uint8_t>(kind) || blob[1] > 1) {
+		throw "ECheckpoint";
+	}
+	size_t offset = 2;
+	if (get_varint_(blob, &offset) != n_avail ||
+			get_varint_(blob, &offset) != sample_sz) {
+		throw "ECheckpoint";
+	}
+	if (blob[1] == 0) {
+		if (offset != blob.size()) throw "ECheckpoint";
+		return false;
+	}
+	positions->resize(sample_sz);
+	for (size_t i = 0; i < sample_sz; ++i) {
+		size_t position = get_varint_(blob, &offset);
+		if (kind == checkpoint_kind_::combination && i != 0) {
+			if (position == 0) throw "ECheckpoint";	// not ascending
+			position += (*positions)[i - 1];
+		}
+		if (position >= n_avail) throw "ECheckpoint";
+		(*positions)[i] = position;
+	}
+	if (offset != blob.size()) throw "ECheckpoint";
+	if (kind == checkpoint_kind_::permutation) {
+		std::vector<size_t> sorted = *positions;
+		std::sort(sorted.begin(), sorted.end());
+		if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+			throw "ECheckpoint";	// repeated position
+		}
+	}
+	return true;
+}
+
+}	// namespace internal
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::sample_view                            /
+ '--------------------------------------------------------------------------' */
+
+template <typename TargetCit>
+/** @brief Non-owning view of an enumeration sample (a contiguous sequence of
+	 target const_iterators). Dereferencing yields the target values, so the
+	 sample can be inspected without copying it into a new container. */
+class sample_view {
+ public:
+	using value_type = typename std::iterator_traits<TargetCit>::value_type;
+	using reference = typename std::iterator_traits<TargetCit>::reference;
+	using size_type = size_t;
+
+	/** @brief Random-access const iterator over the viewed values. */
+	class const_iterator {
+	 public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = typename sample_view::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = typename std::iterator_traits<TargetCit>::pointer;
+		using reference = typename sample_view::reference;
+
+		const_iterator() = default;
+		explicit const_iterator(const TargetCit *pos) : pos_(pos) {}
+
+		reference operator*() const { return **pos_; }
+		pointer operator->() const { return &**pos_; }
+		reference operator[](difference_type n) const { return *pos_[n]; }
+
+		/** @brief Returns the underlying target const_iterator. */
+		const TargetCit &base() const { return *pos_; }
+
+		const_iterator &operator++() {
+			++pos_;
+			return *this;
+		}
+		const_iterator operator++(int) { return const_iterator(pos_++); }
+		const_iterator &operator--() {
+			--pos_;
+			return *this;
+		}
+		const_iterator operator--(int) { return const_iterator(pos_--); }
+		const_iterator &operator+=(difference_type n) {
+			pos_ += n;
+			return *this;
+		}
+		const_iterator &operator-=(difference_type n) {
+			pos_ -= n;
+			return *this;
+		}
+		const_iterator operator+(difference_type n) const {
+			return const_iterator(pos_ + n);
+		}
+		const_iterator operator-(difference_type n) const {
+			return const_iterator(pos_ - n);
+		}
+		difference_type operator-(const const_iterator &rhs) const {
+			return pos_ - rhs.pos_;
+		}
+
+		bool operator==(const const_iterator &rhs) const { return pos_ == rhs.pos_; }
+		bool operator!=(const const_iterator &rhs) const { return pos_ != rhs.pos_; }
+		bool operator<(const const_iterator &rhs) const { return pos_ < rhs.pos_; }
+		bool operator>(const const_iterator &rhs) const { return pos_ > rhs.pos_; }
+		bool operator<=(const const_iterator &rhs) const { return pos_ <= rhs.pos_; }
+		bool operator>=(const const_iterator &rhs) const { return pos_ >= rhs.pos_; }
+
+	 private:
+		const TargetCit *pos_ = nullptr;
+	};
+
+	using iterator = const_iterator;
+
+	sample_view(const TargetCit *first, const TargetCit *last)
+			: first_(first), last_(last) {}
+
+	const_iterator begin() const { return const_iterator(first_); }
+	const_iterator end() const { return const_iterator(last_); }
+	const_iterator cbegin() const { return begin(); }
+	const_iterator cend() const { return end(); }
+
+	size_type size() const { return static_cast<size_type>(last_ - first_); }
+	bool empty() const { return first_ == last_; }
+	reference operator[](size_type i) const { return *first_[i]; }
+
+ private:
+	const TargetCit *first_;
+	const TargetCit *last_;
+};
+
+/* .--------------------------------------------------------------------------,
+	/                             ccutl::combinate                             /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+/** @brief Lazy range over all combinations of the values in a container T.
+	 Each combination is produced in place from a single iterator sample, so
+	 memory use is O(sample_sz) regardless of the number of combinations.
+
+	 The target must outlive the range and any of its iterators. */
+class combination_range {
+ public:
+	using target_type = T;
 	using TargetCit = typename T::const_iterator;
-	using SampleRit = typename vector<TargetCit>::reverse_iterator;
-	/*                                                                       */
 
-	// check assertions
-	assert(sample_sz <= target.size());
+	/** @brief Input iterator that steps the sample to the next combination.
+		 Dereferencing yields a sample_view that is invalidated by the next step.
+	 */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sample_view<TargetCit>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first combination. */
+		iterator(const T &target, size_t sample_sz)
+				: sample_(sample_sz),
+					positions_(sample_sz),
+					tlim_(std::prev(target.cend())),
+					scur_(0),
+					done_(false) {
+			// create ascending iterator sample
+			TargetCit base_cit = target.cbegin();
+			std::transform(
+					sample_.begin(), sample_.end(), sample_.begin(),
+					[&]([[maybe_unused]] const auto &v) { return base_cit++; });
+			std::iota(positions_.begin(), positions_.end(), 0);
+		}
 
-	// handle default value
-	if (sample_sz == 0) sample_sz = target.size();
+		/** @brief Constructs an iterator at the combination of the given
+			 ascending target positions. */
+		iterator(const T &target, const std::vector<size_t> &positions)
+				: sample_(positions.size()),
+					positions_(positions),
+					tlim_(std::prev(target.cend())),
+					scur_(0),
+					done_(false) {
+			std::transform(positions.begin(), positions.end(), sample_.begin(),
+										 [&](size_t pos) {
+											 return std::next(target.cbegin(),
+																				static_cast<difference_type>(pos));
+										 });
+		}
 
-	//                Result goes here
-	vector<T> result;
-	//                ----------------
+		reference operator*() const {
+			return value_type(sample_.data(), sample_.data() + sample_.size());
+		}
 
-	if (!repetition) {
-		// use std::next_permutation with all combinations
-		auto combinations = combinate(target, sample_sz);
-		for (auto &combination : combinations) {
-			do {
-				result.push_back(combination);
-			} while (std::next_permutation(combination.begin(), combination.end()));
+		/** @brief Returns the target positions of the current combination. */
+		const std::vector<size_t> &positions() const { return positions_; }
+
+		iterator &operator++() {
+			step();
+			return *this;
 		}
-		return result;
-	} else {
-		// use counting method
 
-		// current target iterator sample
-		vector<TargetCit> sample(sample_sz);
-
-		// beginning of sample iterator
-		SampleRit s_rbegin = sample.rbegin();
-		// end of sample iterator
-		SampleRit s_rend = sample.rend();
-		// current sample iterator
-		SampleRit scur = s_rbegin;
-		// current last position for target iterator (decreases with scur
-		// increase)
-		TargetCit tlim = prev(target.cend());
-		// target beginning iterator
-		TargetCit t_cbegin = target.cbegin();
-
-		// fill with base value
-		fill(s_rbegin, s_rend, t_cbegin);
-
-		// perform logic until done
-		while (true) {
-			// Update result vector
-			{
-				// create subresult
-				T subresult;
-				// fill subresult with iterator endpoints
-				transform(s_rbegin, s_rend, back_insert_iterator(subresult),
-									[](const auto &it) { return *it; });
-				// store the subresult in the results
-				result.push_back(subresult);
-			}
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || sample_ == rhs.sample_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
 
-			if (*scur != tlim) {
-				++*scur;
+	 private:
+		// current target iterator sample
+		std::vector<TargetCit> sample_;
+		// target positions of the sample (mirrors sample_)
+		std::vector<size_t> positions_;
+		// current last position for target iterator (decreases with scur increase)
+		TargetCit tlim_;
+		// current sample position, counted from the back of the sample
+		// (stands in for a vector<TargetCit>::reverse_iterator so that iterator
+		// copies remain valid)
+		size_t scur_ = 0;
+		// whether or not every combination has been visited
+		bool done_ = true;
+
+		TargetCit &scur() { return sample_[sample_.size() - 1 - scur_]; }
+		size_t &spos() { return positions_[positions_.size() - 1 - scur_]; }
+
+		void step() {
+			if (scur() != tlim_) {
+				++scur();
+				++spos();
 			} else {
-				while (*scur == tlim) {
-					++scur;
-					if (scur == s_rend) {
-						return result;
+				while (scur() == tlim_) {
+					++scur_;
+					if (scur_ == sample_.size()) {
+						done_ = true;
+						return;
 					}
+					--tlim_;
 				}
 
-				++*scur;
-
-				while (scur != s_rbegin) {
-					--scur;
-					*scur = t_cbegin;
+				TargetCit tnext = std::next(scur());
+				size_t tnext_pos = spos() + 1;
+
+				while (scur() != tnext) {
+					scur() = tnext;
+					spos() = tnext_pos;
+					if (scur_ != 0) {
+						--scur_;
+						++tlim_;
+						++tnext;
+						++tnext_pos;
+					}
 				}
 			}
 		}
+	};
+
+	combination_range(const T &target, size_t sample_sz)
+			: target_(&target), sample_sz_(sample_sz) {}
+
+	iterator begin() const { return iterator(*target_, sample_sz_); }
+	iterator end() const { return iterator(); }
+
+	/** @brief Returns an iterator at the combination of the given rank (see
+		 combination_unrank). */
+	iterator at(size_t rank) const {
+		return iterator(*target_,
+										combination_unrank(rank, target_->size(), sample_sz_));
+	}
+
+	/** @brief Serializes the state of an iterator of this range to a compact
+		 byte blob (see resume). */
+	std::vector<uint8_t> checkpoint(const iterator &it) const {
+		return internal::save_checkpoint_(
+				internal::checkpoint_kind_::combination, target_->size(), sample_sz_,
+				it == end() ? nullptr : &it.positions());
+	}
+
+	/** @brief Returns an iterator at the state saved by checkpoint. Throws
+		 "ECheckpoint" if the blob was not saved by an equivalent range. */
+	iterator resume(const std::vector<uint8_t> &blob) const {
+		std::vector<size_t> positions;
+		if (!internal::load_checkpoint_(blob,
+																		internal::checkpoint_kind_::combination,
+																		target_->size(), sample_sz_, &positions)) {
+			return end();
+		}
+		return iterator(*target_, positions);
 	}
+
+ private:
+	const T *target_;
+	size_t sample_sz_;
+};
+
+namespace internal {
+
+template <typename T, typename TSource>
+/** @brief Enumerates the combinations of a random-access source (the target
+	 itself or a snapshot of it) into a vector<T>. The combinate_mask kernel is
+	 not used here: stepping masks is slower than stepping positions, and
+	 expanding each mask (with ctz or an AVX-512 compress-store) is no faster
+	 than copying the sample, which building each subresult dominates anyway
+	 (see the combinate / combinate_mask* cases of bench/combinatorics.cc). */
+std::vector<T> combinate_(const TSource &source, size_t sample_sz) {
+	//                Result goes here
+	std::vector<T> result;
+	//                ----------------
+	result.reserve(n_combinations(source.size(), sample_sz));
+
+	for (const auto &sample : lazy_combinate(source, sample_sz)) {
+		// store the subresult in the results
+		result.push_back(make_subresult_<T>(sample));
+	}
+
+	return result;
+}
+
+template <typename T, typename TExecutionPolicy, typename TSource>
+/** @brief Enumerates the combinations of a random-access source into a
+	 vector<T> in chunks using an execution policy. */
+std::vector<T> combinate_(TExecutionPolicy &&policy, const TSource &source,
+													size_t sample_sz) {
+	//                Result goes here
+	std::vector<T> result(n_combinations(source.size(), sample_sz));
+	//                ----------------
+
+	const auto combinations = lazy_combinate(source, sample_sz);
+	for_each_chunk_(policy, result.size(), [&](size_t first, size_t last) {
+		auto it = combinations.at(first);
+		for (size_t i = first; i < last; ++i, ++it) {
+			result[i] = make_subresult_<T>(*it);
+		}
+	});
+
+	return result;
+}
+
+}	// namespace internal
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/** @brief Finds all possible combinations of the values in a container T and
+	 returns the result as a vector<T>. Non-random-access targets are first
+	 copied into a contiguous snapshot (values, or pointers to values that are
+	 not trivially copyable) and enumerated by index. */
+std::vector<T> combinate(const T &target, size_t sample_sz) {
+	// check base cases / assertions
+	size_t n_avail = target.size();
+	if (sample_sz == n_avail) return {target};
+	assert(sample_sz > 0 && sample_sz < n_avail);
+
+	if constexpr (internal::has_random_access_<T>) {
+		return internal::combinate_<T>(target, sample_sz);
+	} else {
+		return internal::combinate_<T>(internal::snapshot_(target), sample_sz);
+	}
+}
+
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> *>
+/** @brief Finds all possible combinations of the values in a container T using
+	 an execution policy. The rank space is split into chunks which are unranked
+	 and enumerated independently into a result of exactly C(n, k) slots.
+	 Non-random-access targets are snapshotted first, as in combinate. */
+std::vector<T> combinate(TExecutionPolicy &&policy, const T &target,
+												 size_t sample_sz) {
+	// check base cases / assertions
+	size_t n_avail = target.size();
+	if (sample_sz == n_avail) return {target};
+	assert(sample_sz > 0 && sample_sz < n_avail);
+
+	if constexpr (internal::has_random_access_<T>) {
+		return internal::combinate_<T>(policy, target, sample_sz);
+	} else {
+		return internal::combinate_<T>(policy, internal::snapshot_(target),
+																	 sample_sz);
+	}
+}
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/** @brief Returns a lazy range over all possible combinations of the values in
+	 a container T. Iteration yields a sample_view of each combination in the
+	 same order as combinate. */
+combination_range<T> lazy_combinate(const T &target, size_t sample_sz) {
+	assert(sample_sz > 0 && sample_sz <= target.size());
+	return combination_range<T>(target, sample_sz);
+}
+
+template <typename T, typename TUnaryOp,
+					std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Calls f with a sample_view of each combination of the values in a
+ * container T, in the same order as combinate. Nothing is materialized.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size
+ * @param f Visitor; may return false to stop the enumeration
+ * @return false if f stopped the enumeration early, otherwise true
+ */
+bool for_each_combination(const T &target, size_t sample_sz,
+													const TUnaryOp &f) {
+	return internal::for_each_sample_(lazy_combinate(target, sample_sz), f);
+}
+
+/**
+ * @brief Returns the lexicographic rank of a combination, i.e. its index in
+ * the output of combinate (combinadic). O(n_avail): each binomial coefficient
+ * is stepped from the previous one in O(1). Throws "EOverflow" only if the rank
+ * itself does not fit in a size_t.
+ *
+ * @param positions Ascending target positions of the combination
+ * @param n_avail Target size
+ * @return size_t
+ */
+inline size_t combination_rank(const std::vector<size_t> &positions,
+															 size_t n_avail) {
+	size_t sample_sz = positions.size();
+	assert(sample_sz > 0 && sample_sz <= n_avail);
+	// every position j skipped before positions[i] precedes the combination by
+	// the C(n_avail - 1 - j, sample_sz - 1 - i) combinations that take j instead.
+	// These counts only shrink along the walk, so the first one that is needed
+	// is computed and the rest are stepped from it
+	size_t rank = 0;
+	size_t binomial = 0;
+	bool known = false;
+	size_t j = 0;
+	for (size_t i = 0; i < sample_sz; ++i) {
+		assert(positions[i] < n_avail);
+		assert(i == 0 || positions[i - 1] < positions[i]);
+		size_t r = sample_sz - 1 - i;
+		for (; j < positions[i]; ++j) {
+			size_t m = n_avail - 1 - j;
+			if (!known) {
+				binomial = n_combinations(m, r);
+				known = true;
+			}
+			safe_add(&rank, binomial);
+			binomial = internal::binomial_step_(binomial, m, m - r);
+		}
+		if (known && r > 0) {
+			binomial = internal::binomial_step_(binomial, n_avail - 1 - j, r);
+		}
+		++j;
+	}
+	return rank;
+}
+
+/**
+ * @brief Returns the ascending target positions of the combination at a given
+ * lexicographic rank (the inverse of combination_rank). O(n_avail): each
+ * binomial coefficient is stepped from the previous one in O(1).
+ *
+ * @param rank Combination rank; must be less than C(n_avail, sample_sz)
+ * @param n_avail Target size
+ * @param sample_sz Sample size
+ * @return std::vector<size_t>
+ */
+inline std::vector<size_t> combination_unrank(size_t rank, size_t n_avail,
+																							size_t sample_sz) {
+	assert(sample_sz > 0 && sample_sz <= n_avail);
+	std::vector<size_t> positions(sample_sz);
+	// skip position j while the rank covers the C(n_avail - 1 - j,
+	// sample_sz - 1 - i) combinations that take it. A count that does not fit in
+	// a size_t always exceeds the rank; once one fits, so do the later ones
+	size_t binomial = 0;
+	bool known = false;
+	for (size_t i = 0, j = 0; i < sample_sz; ++j) {
+		assert(j < n_avail);	// rank < C(n_avail, sample_sz)
+		size_t m = n_avail - 1 - j;
+		size_t r = sample_sz - 1 - i;
+		if (!known) known = internal::n_combinations_(m, r, &binomial);
+		if (known && rank >= binomial) {
+			assert(m > 0);
+			rank -= binomial;
+			binomial = internal::binomial_step_(binomial, m, m - r);
+		} else {
+			positions[i++] = j;
+			if (known && r > 0) binomial = internal::binomial_step_(binomial, m, r);
+		}
+	}
+	return positions;
+}
+
+/* .--------------------------------------------------------------------------,
+	/                          ccutl::combinate_mask                           /
+ '--------------------------------------------------------------------------' */
+
+/** @brief Lazy range over all combinations of sample_sz out of n_avail <= 64
+	 positions, as uint64_t masks (bit i set means target position i is in the
+	 sample). Masks are produced in the same order as combinate, with O(1) bit
+	 operations per step. */
+class combination_mask_range {
+ public:
+	/** @brief Input iterator over combination masks. */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = uint64_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const uint64_t *;
+		using reference = const uint64_t &;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first combination mask. */
+		iterator(size_t n_avail, size_t sample_sz)
+				: mask_(internal::mask_fill_(sample_sz)),
+					full_(internal::mask_fill_(n_avail)),
+					done_(false) {}
+
+		reference operator*() const { return mask_; }
+
+		iterator &operator++() {
+			step();
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || mask_ == rhs.mask_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		// current combination mask
+		uint64_t mask_ = 0;
+		// mask of every target position
+		uint64_t full_ = 0;
+		// whether or not every combination has been visited
+		bool done_ = true;
+
+		void step() {
+			using internal::mask_fill_;
+			using internal::mask_highest_;
+			uint64_t unset = ~mask_ & full_;
+			if (unset == 0) {
+				done_ = true;
+				return;
+			}
+			// positions above the highest unset bit are already at their limits
+			size_t tlim = mask_highest_(unset);
+			size_t n_at_lim = mask_highest_(full_) - tlim;
+			uint64_t rest = mask_ & mask_fill_(tlim);
+			if (rest == 0) {
+				done_ = true;
+				return;
+			}
+			// advance the last movable position and pack the others behind it
+			size_t scur = mask_highest_(rest);
+			mask_ = (rest & ~(uint64_t{1} << scur)) | (uint64_t{1} << (scur + 1));
+			if (n_at_lim != 0) mask_ |= mask_fill_(n_at_lim) << (scur + 2);
+		}
+	};
+
+	combination_mask_range(size_t n_avail, size_t sample_sz)
+			: n_avail_(n_avail), sample_sz_(sample_sz) {}
+
+	iterator begin() const { return iterator(n_avail_, sample_sz_); }
+	iterator end() const { return iterator(); }
+
+ private:
+	size_t n_avail_;
+	size_t sample_sz_;
+};
+
+/** @brief Returns a lazy range over all combinations of sample_sz out of
+	 n_avail <= 64 positions as uint64_t masks, in combinate order. Useful on its
+	 own when only membership (not the values) is needed. */
+inline combination_mask_range combinate_mask(size_t n_avail, size_t sample_sz) {
+	assert(n_avail <= 64);
+	assert(sample_sz > 0 && sample_sz <= n_avail);
+	return combination_mask_range(n_avail, sample_sz);
+}
+
+/* .--------------------------------------------------------------------------,
+	/                     ccutl::revolving_door_combinate                      /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+/** @brief Lazy range over all combinations of the values in a container T in
+	 revolving-door order (Knuth, Algorithm 7.2.1.3R): each step removes exactly
+	 one element and adds exactly one element. The sample stays sorted by target
+	 position.
+
+	 The target must outlive the range and any of its iterators. */
+class revolving_door_range {
+ public:
+	using target_type = T;
+	using TargetCit = typename T::const_iterator;
+
+	/** @brief Input iterator that steps the sample to the next combination.
+		 Dereferencing yields a sample_view that is invalidated by the next step.
+	 */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sample_view<TargetCit>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Value of removed() and added() before the first step. */
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first combination. */
+		iterator(const T &target, size_t sample_sz)
+				: sample_(sample_sz),
+					positions_(sample_sz),
+					n_avail_(target.size()),
+					t_cbegin_(target.cbegin()),
+					done_(false) {
+			// create ascending iterator sample
+			TargetCit base_cit = t_cbegin_;
+			std::transform(
+					sample_.begin(), sample_.end(), sample_.begin(),
+					[&]([[maybe_unused]] const auto &v) { return base_cit++; });
+			std::iota(positions_.begin(), positions_.end(), 0);
+		}
+
+		reference operator*() const {
+			return value_type(sample_.data(), sample_.data() + sample_.size());
+		}
+
+		/** @brief Returns the target positions of the current combination. */
+		const std::vector<size_t> &positions() const { return positions_; }
+
+		/** @brief Returns the target position that left the sample in the last
+			 step. */
+		size_t removed() const { return removed_; }
+
+		/** @brief Returns the target position that entered the sample in the last
+			 step. */
+		size_t added() const { return added_; }
+
+		iterator &operator++() {
+			step();
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || sample_ == rhs.sample_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		// current target iterator sample (ascending)
+		std::vector<TargetCit> sample_;
+		// target positions of the sample (mirrors sample_)
+		std::vector<size_t> positions_;
+		// target size
+		size_t n_avail_ = 0;
+		// target beginning iterator
+		TargetCit t_cbegin_;
+		// target position that left the sample in the last step
+		size_t removed_ = npos;
+		// target position that entered the sample in the last step
+		size_t added_ = npos;
+		// whether or not every combination has been visited
+		bool done_ = true;
+
+		// 1-indexed sample position, with c(sample_sz + 1) == n_avail_
+		size_t c(size_t j) const {
+			return j > positions_.size() ? n_avail_ : positions_[j - 1];
+		}
+
+		// moves sample position j (1-indexed) by one target position
+		void shift(size_t j, bool forward) {
+			removed_ = positions_[j - 1];
+			if (forward) {
+				++sample_[j - 1];
+				++positions_[j - 1];
+			} else {
+				--sample_[j - 1];
+				--positions_[j - 1];
+			}
+			added_ = positions_[j - 1];
+		}
+
+		void step() {
+			size_t t = positions_.size();
+
+			// R3: easy case
+			if (t == n_avail_) {
+				done_ = true;
+				return;
+			} else if (t % 2 == 1) {
+				if (c(1) + 1 < c(2)) {
+					shift(1, true);
+					return;
+				}
+			} else if (c(1) > 0) {
+				shift(1, false);
+				return;
+			}
+
+			// R4 / R5: alternately try to decrease and increase c(j)
+			bool increase = t % 2 == 0;
+			for (size_t j = 2; j <= t; ++j, increase = !increase) {
+				if (!increase) {
+					// R4: c(j) == c(j - 1) + 1
+					if (c(j) >= j) {
+						removed_ = c(j);
+						added_ = j - 2;
+						sample_[j - 1] = sample_[j - 2];
+						positions_[j - 1] = positions_[j - 2];
+						// c(j - 2) == j - 3 (R5 failed for j - 1), so the new c(j - 1)
+						// directly follows it
+						sample_[j - 2] = j == 2 ? t_cbegin_ : std::next(sample_[j - 3]);
+						positions_[j - 2] = j - 2;
+						return;
+					}
+				} else {
+					// R5: c(j - 1) == j - 2
+					if (c(j) + 1 < c(j + 1)) {
+						removed_ = c(j - 1);
+						added_ = c(j) + 1;
+						sample_[j - 2] = sample_[j - 1];
+						positions_[j - 2] = positions_[j - 1];
+						++sample_[j - 1];
+						++positions_[j - 1];
+						return;
+					}
+				}
+			}
+
+			done_ = true;
+		}
+	};
+
+	revolving_door_range(const T &target, size_t sample_sz)
+			: target_(&target), sample_sz_(sample_sz) {}
+
+	iterator begin() const { return iterator(*target_, sample_sz_); }
+	iterator end() const { return iterator(); }
+
+ private:
+	const T *target_;
+	size_t sample_sz_;
+};
+
+template <typename T, std::enable_if_t<internal::has_bidirectional_<T>> *>
+/** @brief Returns a lazy range over all possible combinations of the values in
+	 a container T in revolving-door order. Each step swaps one element out and
+	 one element in; the iterator reports both target positions (removed() and
+	 added()) so that callers may update running state in O(1). Requires
+	 bidirectional target iterators. */
+revolving_door_range<T> revolving_door_combinate(const T &target,
+																								 size_t sample_sz) {
+	assert(sample_sz > 0 && sample_sz <= target.size());
+	return revolving_door_range<T>(target, sample_sz);
+}
+
+/* .--------------------------------------------------------------------------,
+	/                             ccutl::permutate                             /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+/** @brief Lazy range over all permutations of the values in a container T.
+	 Optionally allows for value repetition. Each permutation is produced in
+	 place from a single iterator sample by walking target positions; stepping
+	 allocates nothing, never compares values and is O(1) amortized.
+
+	 The target must outlive the range and any of its iterators. */
+class permutation_range {
+ public:
+	using target_type = T;
+	using TargetCit = typename T::const_iterator;
+
+	/** @brief Input iterator that steps the sample to the next permutation.
+		 Dereferencing yields a sample_view that is invalidated by the next step.
+	 */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sample_view<TargetCit>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first permutation. */
+		iterator(const T &target, size_t sample_sz, bool repetition)
+				: sample_(sample_sz),
+					positions_(sample_sz),
+					tlim_(std::prev(target.cend())),
+					t_cbegin_(target.cbegin()),
+					n_avail_(target.size()),
+					repetition_(repetition),
+					done_(false) {
+			if (repetition_) {
+				// fill with base value
+				std::fill(sample_.begin(), sample_.end(), t_cbegin_);
+			} else {
+				// create ascending iterator sample (the first combination)
+				TargetCit base_cit = t_cbegin_;
+				for (size_t scur = 0; scur < sample_sz; ++scur) {
+					sample_[scur] = base_cit++;
+					positions_[scur] = scur;
+				}
+			}
+		}
+
+		/** @brief Constructs an iterator at the permutation of the given target
+			 positions. */
+		iterator(const T &target, const std::vector<size_t> &positions,
+						 bool repetition)
+				: sample_(positions.size()),
+					positions_(positions),
+					tlim_(std::prev(target.cend())),
+					t_cbegin_(target.cbegin()),
+					n_avail_(target.size()),
+					repetition_(repetition),
+					done_(false) {
+			std::transform(positions.begin(), positions.end(), sample_.begin(),
+										 [&](size_t pos) {
+											 return std::next(t_cbegin_,
+																				static_cast<difference_type>(pos));
+										 });
+		}
+
+		reference operator*() const {
+			return value_type(sample_.data(), sample_.data() + sample_.size());
+		}
+
+		/** @brief Returns the target positions of the current permutation. */
+		const std::vector<size_t> &positions() const { return positions_; }
+
+		iterator &operator++() {
+			if (repetition_) {
+				step_counting();
+			} else {
+				step_arrangement();
+			}
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || sample_ == rhs.sample_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		// current target iterator sample (in output order)
+		std::vector<TargetCit> sample_;
+		// target positions of the sample (mirrors sample_)
+		std::vector<size_t> positions_;
+		// last value of target iterator before end
+		TargetCit tlim_;
+		// target beginning iterator
+		TargetCit t_cbegin_;
+		// target size
+		size_t n_avail_ = 0;
+		// whether or not to allow repetition
+		bool repetition_ = false;
+		// whether or not every permutation has been visited
+		bool done_ = true;
+
+		// use counting method; the first sample position counts fastest
+		void step_counting() {
+			if (sample_.front() != tlim_) {
+				++sample_.front();
+				++positions_.front();
+			} else {
+				size_t scur = 0;
+				while (sample_[scur] == tlim_) {
+					++scur;
+					if (scur == sample_.size()) {
+						done_ = true;
+						return;
+					}
+				}
+
+				++sample_[scur];
+				++positions_[scur];
+
+				while (scur != 0) {
+					--scur;
+					sample_[scur] = t_cbegin_;
+					positions_[scur] = 0;
+				}
+			}
+		}
+
+		// arrange each combination in ascending order of target positions
+		// (std::next_permutation over positions_, mirrored into sample_); the
+		// last arrangement is descending, so reversing it restores the
+		// combination, which then advances in place
+		void step_arrangement() {
+			size_t i = positions_.size() - 1;
+			while (i != 0 && positions_[i - 1] > positions_[i]) --i;
+			if (i == 0) {
+				for (size_t j = positions_.size() - 1; i < j; ++i, --j) {
+					swap_samples(i, j);
+				}
+				step_combination();
+				return;
+			}
+			size_t j = positions_.size() - 1;
+			while (positions_[j] < positions_[i - 1]) --j;
+			swap_samples(i - 1, j);
+			for (j = positions_.size() - 1; i < j; ++i, --j) swap_samples(i, j);
+		}
+
+		// advances the ascending sample to the next combination in lexicographic
+		// order of target positions
+		void step_combination() {
+			size_t sample_sz = positions_.size();
+			// find the last position that has not reached its limit
+			size_t scur = sample_sz;
+			while (scur != 0 &&
+						 positions_[scur - 1] == n_avail_ - sample_sz + scur - 1) {
+				--scur;
+			}
+			if (scur == 0) {
+				done_ = true;
+				return;
+			}
+			// advance it and reset every following position to its successor
+			++sample_[scur - 1];
+			++positions_[scur - 1];
+			for (; scur < sample_sz; ++scur) {
+				sample_[scur] = std::next(sample_[scur - 1]);
+				positions_[scur] = positions_[scur - 1] + 1;
+			}
+		}
+
+		void swap_samples(size_t a, size_t b) {
+			std::swap(sample_[a], sample_[b]);
+			std::swap(positions_[a], positions_[b]);
+		}
+	};
+
+	permutation_range(const T &target, size_t sample_sz, bool repetition)
+			: target_(&target), sample_sz_(sample_sz), repetition_(repetition) {}
+
+	iterator begin() const {
+		return iterator(*target_, sample_sz_, repetition_);
+	}
+	iterator end() const { return iterator(); }
+
+	/** @brief Returns an iterator at the permutation of the given rank (see
+		 permutation_unrank). */
+	iterator at(size_t rank) const {
+		return iterator(
+				*target_,
+				permutation_unrank(rank, target_->size(), sample_sz_, repetition_),
+				repetition_);
+	}
+
+	/** @brief Serializes the state of an iterator of this range to a compact
+		 byte blob (see resume). */
+	std::vector<uint8_t> checkpoint(const iterator &it) const {
+		return internal::save_checkpoint_(kind(), target_->size(), sample_sz_,
+																			it == end() ? nullptr : &it.positions());
+	}
+
+	/** @brief Returns an iterator at the state saved by checkpoint. Throws
+		 "ECheckpoint" if the blob was not saved by an equivalent range. */
+	iterator resume(const std::vector<uint8_t> &blob) const {
+		std::vector<size_t> positions;
+		if (!internal::load_checkpoint_(blob, kind(), target_->size(), sample_sz_,
+																		&positions)) {
+			return end();
+		}
+		return iterator(*target_, positions, repetition_);
+	}
+
+ private:
+	const T *target_;
+	size_t sample_sz_;
+	bool repetition_;
+
+	internal::checkpoint_kind_ kind() const {
+		return repetition_ ? internal::checkpoint_kind_::permutation_repetition
+											 : internal::checkpoint_kind_::permutation;
+	}
+};
+
+namespace internal {
+
+template <typename T, typename TSource>
+/** @brief Enumerates the permutations of a random-access source (the target
+	 itself or a snapshot of it) into a vector<T>. */
+std::vector<T> permutate_(const TSource &source, size_t sample_sz,
+													bool repetition) {
+	//                Result goes here
+	std::vector<T> result;
+	//                ----------------
+	result.reserve(n_permutations(source.size(), sample_sz, repetition));
+
+	for (const auto &sample : lazy_permutate(source, sample_sz, repetition)) {
+		// store the subresult in the results
+		result.push_back(make_subresult_<T>(sample));
+	}
+
+	return result;
+}
+
+template <typename T, typename TExecutionPolicy, typename TSource>
+/** @brief Enumerates the permutations of a random-access source into a
+	 vector<T> in chunks using an execution policy. */
+std::vector<T> permutate_(TExecutionPolicy &&policy, const TSource &source,
+													size_t sample_sz, bool repetition) {
+	//                Result goes here
+	std::vector<T> result(n_permutations(source.size(), sample_sz, repetition));
+	//                ----------------
+
+	const auto permutations = lazy_permutate(source, sample_sz, repetition);
+	for_each_chunk_(policy, result.size(), [&](size_t first, size_t last) {
+		auto it = permutations.at(first);
+		for (size_t i = first; i < last; ++i, ++it) {
+			result[i] = make_subresult_<T>(*it);
+		}
+	});
+
+	return result;
+}
+
+}	// namespace internal
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Finds all possible permutations of the values in a container T and
+ * returns the result as a vector<T>. Optionally allows for value repetition.
+ * Non-random-access targets are snapshotted first, as in combinate.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @return std::vector<T>
+ */
+std::vector<T> permutate(const T &target, size_t sample_sz, bool repetition) {
+	// check assertions
+	assert(repetition || sample_sz <= target.size());
+
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+
+	if constexpr (internal::has_random_access_<T>) {
+		return internal::permutate_<T>(target, sample_sz, repetition);
+	} else {
+		return internal::permutate_<T>(internal::snapshot_(target), sample_sz,
+																	 repetition);
+	}
+}
+
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> *>
+/**
+ * @brief Finds all possible permutations of the values in a container T using
+ * an execution policy. The rank space is split into chunks which are unranked
+ * and enumerated independently into a result of exactly P(n, k) (or n^k) slots.
+ * Non-random-access targets are snapshotted first, as in combinate.
+ *
+ * @param policy Execution policy used to run the chunks
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @return std::vector<T>
+ */
+std::vector<T> permutate(TExecutionPolicy &&policy, const T &target,
+												 size_t sample_sz, bool repetition) {
+	// check assertions
+	assert(repetition || sample_sz <= target.size());
+
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+
+	if constexpr (internal::has_random_access_<T>) {
+		return internal::permutate_<T>(policy, target, sample_sz, repetition);
+	} else {
+		return internal::permutate_<T>(policy, internal::snapshot_(target),
+																	 sample_sz, repetition);
+	}
+}
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Returns a lazy range over all possible permutations of the values in
+ * a container T. Iteration yields a sample_view of each permutation in the
+ * same order as permutate.
+ *
+ * @param target Target container (must outlive the range)
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @return permutation_range<T>
+ */
+permutation_range<T> lazy_permutate(const T &target, size_t sample_sz,
+																		bool repetition) {
+	// check assertions
+	assert(repetition || sample_sz <= target.size());
+
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+
+	assert(sample_sz > 0);
+
+	return permutation_range<T>(target, sample_sz, repetition);
+}
+
+template <typename T, typename TUnaryOp,
+					std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Calls f with a sample_view of each permutation of the values in a
+ * container T, in the same order as permutate. Nothing is materialized.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @param f Visitor; may return false to stop the enumeration
+ * @return false if f stopped the enumeration early, otherwise true
+ */
+bool for_each_permutation(const T &target, size_t sample_sz, bool repetition,
+													const TUnaryOp &f) {
+	return internal::for_each_sample_(
+			lazy_permutate(target, sample_sz, repetition), f);
+}
+
+template <typename T>
+/** @brief Lazy range over all full-length permutations of the values in a
+	 container T, generated with Heap's algorithm. Every step is a single swap
+	 of two sample positions, reported by the iterator, and all n! orderings
+	 are produced regardless of the order (or equality) of the input values.
+
+	 The target must outlive the range and any of its iterators. */
+class swap_permutation_range {
+ public:
+	using target_type = T;
+	using TargetCit = typename T::const_iterator;
+
+	/** @brief Input iterator that steps the sample to the next permutation.
+		 Dereferencing yields a sample_view that is invalidated by the next step.
+	 */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sample_view<TargetCit>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first permutation (the target
+			 order). */
+		explicit iterator(const T &target)
+				: sample_(target.size()),
+					positions_(target.size()),
+					counters_(target.size(), 0),
+					level_(1),
+					done_(false) {
+			TargetCit base_cit = target.cbegin();
+			std::transform(
+					sample_.begin(), sample_.end(), sample_.begin(),
+					[&]([[maybe_unused]] const auto &v) { return base_cit++; });
+			std::iota(positions_.begin(), positions_.end(), 0);
+		}
+
+		reference operator*() const {
+			return value_type(sample_.data(), sample_.data() + sample_.size());
+		}
+
+		/** @brief Returns the target positions of the current permutation. */
+		const std::vector<size_t> &positions() const { return positions_; }
+
+		/** @brief Returns the two sample indices exchanged by the last step
+			 (both 0 before the first step). */
+		std::pair<size_t, size_t> swapped() const { return swapped_; }
+
+		iterator &operator++() {
+			step();
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || sample_ == rhs.sample_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		// current target iterator sample
+		std::vector<TargetCit> sample_;
+		// target positions of the sample (mirrors sample_)
+		std::vector<size_t> positions_;
+		// Heap's algorithm stack state
+		std::vector<size_t> counters_;
+		// current Heap's algorithm level
+		size_t level_ = 1;
+		// sample indices exchanged by the last step
+		std::pair<size_t, size_t> swapped_{0, 0};
+		// whether or not every permutation has been visited
+		bool done_ = true;
+
+		void step() {
+			while (level_ < sample_.size()) {
+				if (counters_[level_] < level_) {
+					size_t other = level_ % 2 == 0 ? 0 : counters_[level_];
+					std::swap(sample_[other], sample_[level_]);
+					std::swap(positions_[other], positions_[level_]);
+					swapped_ = {other, level_};
+					++counters_[level_];
+					level_ = 1;
+					return;
+				}
+				counters_[level_] = 0;
+				++level_;
+			}
+			done_ = true;
+		}
+	};
+
+	explicit swap_permutation_range(const T &target) : target_(&target) {}
+
+	iterator begin() const { return iterator(*target_); }
+	iterator end() const { return iterator(); }
+
+ private:
+	const T *target_;
+};
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/** @brief Returns a lazy range over all full-length permutations of the values
+	 in a container T in Heap's order. Each step swaps exactly two positions,
+	 which the iterator reports via swapped(). */
+swap_permutation_range<T> swap_permutate(const T &target) {
+	assert(target.size() > 0);
+	return swap_permutation_range<T>(target);
+}
+
+namespace internal {
+
+template <typename T>
+/** @brief Groups equal values (compared with ==) of a container T by their
+	 first occurrence: stores the first occurrence of each distinct value in
+	 values and its number of occurrences in counts. */
+void group_values_(const T &target,
+									 std::vector<typename T::const_iterator> *values,
+									 std::vector<size_t> *counts) {
+	for (auto cit = target.cbegin(); cit != target.cend(); ++cit) {
+		size_t group = 0;
+		while (group != values->size() && !(*(*values)[group] == *cit)) ++group;
+		if (group == values->size()) {
+			values->push_back(cit);
+			counts->push_back(0);
+		}
+		++(*counts)[group];
+	}
+}
+
+/** @brief Returns the number of distinct sequences of sample_sz values drawn
+	 from groups of counts[g] equal values (the multinomial coefficient when
+	 sample_sz uses every value). Throws "EOverflow" if it does not fit in a
+	 size_t. O(n_values * sample_sz). */
+inline size_t n_multiset_permutations_(const std::vector<size_t> &counts,
+																			 size_t sample_sz) {
+	// n_sequences[m] counts the sequences of length m over the groups so far;
+	// adding a group places j of its values at C(m, j) sets of positions. Every
+	// partial count is at most the final one, so only that can overflow
+	std::vector<size_t> n_sequences(sample_sz + 1);
+	n_sequences[0] = 1;
+	for (size_t count : counts) {
+		for (size_t m = sample_sz; m != 0; --m) {
+			for (size_t j = 1; j <= std::min(count, m); ++j) {
+				safe_add(&n_sequences[m],
+								 safe_mul<size_t>(n_sequences[m - j], n_combinations(m, j)));
+			}
+		}
+	}
+	return n_sequences[sample_sz];
+}
+
+}	// namespace internal
+
+template <typename T>
+/** @brief Lazy range over the distinct permutations of a container T whose
+	 values may repeat (see lazy_multiset_permutate). */
+class multiset_permutation_range {
+ public:
+	using target_type = T;
+	using TargetCit = typename T::const_iterator;
+
+	/** @brief Input iterator that steps the sample to the next distinct
+		 permutation. Dereferencing yields a sample_view that is invalidated by
+		 the next step. */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sample_view<TargetCit>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first distinct permutation. */
+		iterator(const T &target, size_t sample_sz)
+				: sample_(sample_sz), groups_(sample_sz), done_(false) {
+			internal::group_values_(target, &values_, &counts_);
+			fill(0);
+		}
+
+		reference operator*() const {
+			return value_type(sample_.data(), sample_.data() + sample_.size());
+		}
+
+		/** @brief Returns the value group of each sample position. Groups are
+			 numbered by the first occurrence of their value in the target. */
+		const std::vector<size_t> &groups() const { return groups_; }
+
+		iterator &operator++() {
+			step();
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || groups_ == rhs.groups_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		// current target iterator sample
+		std::vector<TargetCit> sample_;
+		// value group of each sample position (mirrors sample_)
+		std::vector<size_t> groups_;
+		// first occurrence of each distinct value
+		std::vector<TargetCit> values_;
+		// number of unused occurrences of each distinct value
+		std::vector<size_t> counts_;
+		// whether or not every permutation has been visited
+		bool done_ = true;
+
+		// lexicographic successor over group numbers: release positions from the
+		// back until one can take a later group, then refill the rest in order
+		void step() {
+			for (size_t scur = groups_.size(); scur != 0;) {
+				--scur;
+				++counts_[groups_[scur]];
+				size_t group = groups_[scur] + 1;
+				while (group != counts_.size() && counts_[group] == 0) ++group;
+				if (group != counts_.size()) {
+					take(scur, group);
+					fill(scur + 1);
+					return;
+				}
+			}
+			done_ = true;
+		}
+
+		// fills the positions from first onward with the lowest available groups
+		void fill(size_t first) {
+			size_t group = 0;
+			for (size_t scur = first; scur < groups_.size(); ++scur) {
+				while (counts_[group] == 0) ++group;
+				take(scur, group);
+			}
+		}
+
+		void take(size_t scur, size_t group) {
+			--counts_[group];
+			groups_[scur] = group;
+			sample_[scur] = values_[group];
+		}
+	};
+
+	multiset_permutation_range(const T &target, size_t sample_sz)
+			: target_(&target), sample_sz_(sample_sz) {}
+
+	iterator begin() const { return iterator(*target_, sample_sz_); }
+	iterator end() const { return iterator(); }
+
+ private:
+	const T *target_;
+	size_t sample_sz_;
+};
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Returns a lazy range over the distinct permutations of the values in
+ * a container T. Equal values (compared with ==) are counted rather than
+ * enumerated, so each arrangement of values is visited exactly once, in
+ * lexicographic order of first occurrence (sorted order for sorted targets).
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @return multiset_permutation_range<T>
+ */
+multiset_permutation_range<T> lazy_multiset_permutate(const T &target,
+																											size_t sample_sz) {
+	// check assertions
+	assert(sample_sz <= target.size());
+
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+
+	return multiset_permutation_range<T>(target, sample_sz);
+}
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Finds the distinct permutations of the values in a container T (see
+ * lazy_multiset_permutate). Equivalent to deduplicating the output of
+ * permutate, without enumerating the duplicates.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @return std::vector<T>
+ */
+std::vector<T> multiset_permutate(const T &target, size_t sample_sz) {
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+
+	//                Result goes here
+	std::vector<T> result;
+	//                ----------------
+	std::vector<typename T::const_iterator> values;
+	std::vector<size_t> counts;
+	internal::group_values_(target, &values, &counts);
+	result.reserve(internal::n_multiset_permutations_(counts, sample_sz));
+
+	for (const auto &sample : lazy_multiset_permutate(target, sample_sz)) {
+		// store the subresult in the results
+		result.push_back(internal::make_subresult_<T>(sample));
+	}
+
+	return result;
+}
+
+/**
+ * @brief Returns the rank of a permutation, i.e. its index in the output of
+ * permutate. With repetition the rank is a mixed-radix number (the first
+ * position is least significant). Without repetition it is the rank of the
+ * underlying combination followed by the Lehmer code of its arrangement.
+ * Throws "EOverflow" if the rank does not fit in a size_t.
+ *
+ * @param positions Target positions of the permutation (in output order)
+ * @param n_avail Target size
+ * @param repetition Whether or not repetition is allowed
+ * @return size_t
+ */
+inline size_t permutation_rank(const std::vector<size_t> &positions,
+															 size_t n_avail, bool repetition) {
+	size_t sample_sz = positions.size();
+	assert(sample_sz > 0 && (repetition || sample_sz <= n_avail));
+
+	size_t rank = 0;
+	if (repetition) {
+		for (auto it = positions.crbegin(); it != positions.crend(); ++it) {
+			assert(*it < n_avail);
+			safe_mul(&rank, n_avail);
+			safe_add(&rank, *it);
+		}
+	} else {
+		std::vector<size_t> combination = positions;
+		std::sort(combination.begin(), combination.end());
+		rank = combination_rank(combination, n_avail);
+		// Lehmer code of the arrangement
+		for (size_t i = 0; i < sample_sz; ++i) {
+			size_t n_smaller = 0;
+			for (size_t j = i + 1; j < sample_sz; ++j) {
+				if (positions[j] < positions[i]) ++n_smaller;
+			}
+			safe_mul(&rank, sample_sz - i);
+			safe_add(&rank, n_smaller);
+		}
+	}
+	return rank;
+}
+
+/**
+ * @brief Returns the target positions of the permutation at a given rank (the
+ * inverse of permutation_rank). Any rank that fits in size_t decodes, even if
+ * the number of permutations does not.
+ *
+ * @param rank Permutation rank
+ * @param n_avail Target size
+ * @param sample_sz Sample size (sz of 0 uses n_avail)
+ * @param repetition Whether or not repetition is allowed
+ * @return std::vector<size_t>
+ */
+inline std::vector<size_t> permutation_unrank(size_t rank, size_t n_avail,
+																							size_t sample_sz,
+																							bool repetition) {
+	// handle default value
+	if (sample_sz == 0) sample_sz = n_avail;
+	assert(sample_sz > 0 && (repetition || sample_sz <= n_avail));
+
+	std::vector<size_t> positions(sample_sz);
+	if (repetition) {
+		for (auto &pos : positions) {
+			pos = rank % n_avail;
+			rank /= n_avail;
+		}
+		assert(rank == 0);
+	} else {
+		// place value of each Lehmer digit, (sample_sz - 1 - i)!, without forming
+		// sample_sz! (which overflows for sample_sz > 20). A rank that fits has a
+		// zero digit wherever the place value does not fit (marked as 0).
+		std::vector<size_t> place_values(sample_sz);
+		size_t place_value = 1;
+		for (size_t i = sample_sz; i-- > 0;) {
+			place_values[i] = place_value;
+			size_t radix = sample_sz - i;
+			place_value = place_value > std::numeric_limits<size_t>::max() / radix
+												? 0
+												: place_value * radix;
+		}
+		// place_value is now sample_sz! (or 0), the weight of the combination
+		std::vector<size_t> combination = combination_unrank(
+				place_value == 0 ? 0 : rank / place_value, n_avail, sample_sz);
+		if (place_value != 0) rank %= place_value;
+		// decode the Lehmer code of the arrangement
+		for (size_t i = 0; i < sample_sz; ++i) {
+			size_t digit = 0;
+			if (place_values[i] != 0) {
+				digit = rank / place_values[i];
+				rank %= place_values[i];
+			}
+			auto it = combination.begin() + static_cast<std::ptrdiff_t>(digit);
+			positions[i] = *it;
+			combination.erase(it);
+		}
+	}
+	return positions;
+}
+
+/* .--------------------------------------------------------------------------,
+	/                           ccutl::flat_samples                            /
+ '--------------------------------------------------------------------------' */
+
+template <typename TValue>
+/** @brief Enumeration result stored in a single contiguous buffer of
+	 size() * stride() values. Behaves as a random-access range of rows (spans
+	 of stride() values), so results cost one allocation and scan linearly. */
+class flat_samples {
+ public:
+	using value_type = TValue;
+	using size_type = size_t;
+
+	/** @brief Non-owning view of one sample (a span of stride() values). */
+	class row {
+	 public:
+		using value_type = TValue;
+		using const_iterator = const TValue *;
+		using iterator = const_iterator;
+
+		row(const TValue *first, size_t size) : first_(first), size_(size) {}
+
+		const_iterator begin() const { return first_; }
+		const_iterator end() const { return first_ + size_; }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		size_type size() const { return size_; }
+		bool empty() const { return size_ == 0; }
+		const TValue *data() const { return first_; }
+		const TValue &operator[](size_type i) const { return first_[i]; }
+
+	 private:
+		const TValue *first_;
+		size_t size_;
+	};
+
+	/** @brief Random-access const iterator over rows. */
+	class const_iterator {
+	 public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = row;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = row;
+
+		const_iterator() = default;
+		const_iterator(const TValue *pos, size_t stride)
+				: pos_(pos), stride_(stride) {}
+
+		reference operator*() const { return row(pos_, stride_); }
+		reference operator[](difference_type n) const { return *(*this + n); }
+
+		const_iterator &operator++() {
+			pos_ += stride_;
+			return *this;
+		}
+		const_iterator operator++(int) {
+			const_iterator prev = *this;
+			++*this;
+			return prev;
+		}
+		const_iterator &operator--() {
+			pos_ -= stride_;
+			return *this;
+		}
+		const_iterator operator--(int) {
+			const_iterator prev = *this;
+			--*this;
+			return prev;
+		}
+		const_iterator &operator+=(difference_type n) {
+			pos_ += n * static_cast<difference_type>(stride_);
+			return *this;
+		}
+		const_iterator &operator-=(difference_type n) {
+			pos_ -= n * static_cast<difference_type>(stride_);
+			return *this;
+		}
+		const_iterator operator+(difference_type n) const {
+			return const_iterator(*this) += n;
+		}
+		const_iterator operator-(difference_type n) const {
+			return const_iterator(*this) -= n;
+		}
+		difference_type operator-(const const_iterator &rhs) const {
+			return (pos_ - rhs.pos_) / static_cast<difference_type>(stride_);
+		}
+
+		bool operator==(const const_iterator &rhs) const { return pos_ == rhs.pos_; }
+		bool operator!=(const const_iterator &rhs) const { return pos_ != rhs.pos_; }
+		bool operator<(const const_iterator &rhs) const { return pos_ < rhs.pos_; }
+		bool operator>(const const_iterator &rhs) const { return pos_ > rhs.pos_; }
+		bool operator<=(const const_iterator &rhs) const { return pos_ <= rhs.pos_; }
+		bool operator>=(const const_iterator &rhs) const { return pos_ >= rhs.pos_; }
+
+	 private:
+		const TValue *pos_ = nullptr;
+		size_t stride_ = 0;
+	};
+
+	using iterator = const_iterator;
+
+	flat_samples() = default;
+
+	/** @brief Allocates (value-initialized) storage for n_samples samples of
+		 stride values each. Throws "EOverflow" if the number of values does not
+		 fit in a size_t. */
+	flat_samples(size_t n_samples, size_t stride)
+			: data_(safe_mul<size_t>(n_samples, stride)),
+				n_samples_(n_samples),
+				stride_(stride) {}
+
+	const_iterator begin() const { return const_iterator(data_.data(), stride_); }
+	const_iterator end() const {
+		return const_iterator(data_.data() + data_.size(), stride_);
+	}
+	const_iterator cbegin() const { return begin(); }
+	const_iterator cend() const { return end(); }
+
+	/** @brief Returns the number of samples. */
+	size_type size() const { return n_samples_; }
+	/** @brief Returns the number of values in each sample. */
+	size_type stride() const { return stride_; }
+	bool empty() const { return n_samples_ == 0; }
+
+	row operator[](size_type i) const {
+		return row(data_.data() + i * stride_, stride_);
+	}
+
+	/** @brief Returns the contiguous buffer of size() * stride() values. */
+	TValue *data() { return data_.data(); }
+	const TValue *data() const { return data_.data(); }
+
+ private:
+	std::vector<TValue> data_;
+	size_t n_samples_ = 0;
+	size_t stride_ = 0;
+};
+
+namespace internal {
+
+template <typename TRange, typename TValue>
+/** @brief Copies the samples [first, last) of an enumeration range into their
+	 rows of a flat_samples buffer. */
+void fill_flat_samples_(const TRange &range, size_t first, size_t last,
+												flat_samples<TValue> *result) {
+	TValue *out = result->data() + first * result->stride();
+	auto it = first == 0 ? range.begin() : range.at(first);
+	for (size_t i = first; i < last; ++i, ++it) {
+		const auto sample = *it;
+		out = std::copy(sample.begin(), sample.end(), out);
+	}
+}
+
+}	// namespace internal
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/** @brief Finds all possible combinations of the values in a container T and
+	 returns them in a single contiguous buffer (one allocation). Rows are in
+	 the same order as combinate. */
+flat_samples<typename T::value_type> combinate_flat(const T &target,
+																										size_t sample_sz) {
+	flat_samples<typename T::value_type> result(
+			n_combinations(target.size(), sample_sz), sample_sz);
+	internal::fill_flat_samples_(lazy_combinate(target, sample_sz), 0,
+															 result.size(), &result);
+	return result;
+}
+
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> *>
+/** @brief Same as combinate_flat, but fills chunks of rows using an execution
+	 policy. */
+flat_samples<typename T::value_type> combinate_flat(TExecutionPolicy &&policy,
+																										const T &target,
+																										size_t sample_sz) {
+	flat_samples<typename T::value_type> result(
+			n_combinations(target.size(), sample_sz), sample_sz);
+	const auto combinations = lazy_combinate(target, sample_sz);
+	internal::for_each_chunk_(policy, result.size(),
+														[&](size_t first, size_t last) {
+															internal::fill_flat_samples_(
+																	combinations, first, last, &result);
+														});
+	return result;
+}
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Finds all possible permutations of the values in a container T and
+ * returns them in a single contiguous buffer (one allocation). Rows are in the
+ * same order as permutate.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @return flat_samples<typename T::value_type>
+ */
+flat_samples<typename T::value_type> permutate_flat(const T &target,
+																										size_t sample_sz,
+																										bool repetition) {
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+	flat_samples<typename T::value_type> result(
+			n_permutations(target.size(), sample_sz, repetition), sample_sz);
+	internal::fill_flat_samples_(lazy_permutate(target, sample_sz, repetition),
+															 0, result.size(), &result);
+	return result;
+}
+
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> *>
+/** @brief Same as permutate_flat, but fills chunks of rows using an execution
+	 policy. */
+flat_samples<typename T::value_type> permutate_flat(TExecutionPolicy &&policy,
+																										const T &target,
+																										size_t sample_sz,
+																										bool repetition) {
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+	flat_samples<typename T::value_type> result(
+			n_permutations(target.size(), sample_sz, repetition), sample_sz);
+	const auto permutations = lazy_permutate(target, sample_sz, repetition);
+	internal::for_each_chunk_(policy, result.size(),
+														[&](size_t first, size_t last) {
+															internal::fill_flat_samples_(
+																	permutations, first, last, &result);
+														});
+	return result;
+}
+
+/* .--------------------------------------------------------------------------,
+	/               ccutl::combination_table / permutation_table               /
+ '--------------------------------------------------------------------------' */
+
+template <size_t N, size_t K>
+/**
+ * @brief Returns every combination of K out of N positions as a compile-time
+ * table of index tuples, in the same order as combinate. Intended for fixed
+ * shapes (e.g. every 3-subset of 8 lanes); bind the result to a constexpr
+ * variable to have it emitted as read-only data.
+ *
+ * @tparam N Number of available positions
+ * @tparam K Sample size
+ * @return constexpr std::array<std::array<size_t, K>, n_combinations(N, K)>
+ */
+constexpr auto combination_table() {
+	static_assert(K > 0 && K <= N, "sample size must be within (0, N]");
+
+	//                Result goes here
+	std::array<std::array<size_t, K>, n_combinations(N, K)> result{};
+	//                ----------------
+
+	std::array<size_t, K> positions{};
+	for (size_t i = 0; i < K; ++i) positions[i] = i;
+
+	for (size_t rank = 0; rank < result.size(); ++rank) {
+		result[rank] = positions;
+		// find the last position that has not reached its limit
+		size_t i = K;
+		while (i != 0 && positions[i - 1] == N - K + i - 1) --i;
+		if (i == 0) break;
+		// advance it and reset every following position to its successor
+		++positions[i - 1];
+		for (; i < K; ++i) positions[i] = positions[i - 1] + 1;
+	}
+
+	return result;
+}
+
+template <size_t N, size_t K, bool Repetition>
+/**
+ * @brief Returns every permutation of K out of N positions as a compile-time
+ * table of index tuples, in the same order as permutate (optionally with
+ * repetition).
+ *
+ * @tparam N Number of available positions
+ * @tparam K Sample size (defaults to N)
+ * @tparam Repetition Whether or not to allow repetition
+ * @return constexpr std::array<std::array<size_t, K>,
+ *                              n_permutations(N, K, Repetition)>
+ */
+constexpr auto permutation_table() {
+	static_assert(K > 0 && (Repetition || K <= N),
+								"sample size must be within (0, N]");
+
+	//                Result goes here
+	std::array<std::array<size_t, K>, n_permutations(N, K, Repetition)> result{};
+	//                ----------------
+
+	if constexpr (Repetition) {
+		// count with the first position moving fastest
+		std::array<size_t, K> positions{};
+		for (size_t rank = 0; rank < result.size(); ++rank) {
+			result[rank] = positions;
+			for (size_t i = 0; i < K && ++positions[i] == N; ++i) positions[i] = 0;
+		}
+	} else {
+		// arrange each combination in ascending order of target positions
+		size_t rank = 0;
+		for (auto positions : combination_table<N, K>()) {
+			while (true) {
+				result[rank++] = positions;
+				// std::next_permutation (std::swap is not constexpr until C++20)
+				auto swap = [&positions](size_t a, size_t b) {
+					size_t tmp = positions[a];
+					positions[a] = positions[b];
+					positions[b] = tmp;
+				};
+				size_t i = K - 1;
+				while (i != 0 && positions[i - 1] > positions[i]) --i;
+				if (i == 0) break;
+				size_t j = K - 1;
+				while (positions[j] < positions[i - 1]) --j;
+				swap(i - 1, j);
+				for (j = K - 1; i < j; ++i, --j) swap(i, j);
+			}
+		}
+	}
+
+	return result;
+}
+
+/* .--------------------------------------------------------------------------,
+	/             ccutl::sample_combinations / sample_permutations             /
+ '--------------------------------------------------------------------------' */
+
+namespace internal {
+
+template <typename TRng>
+/** @brief Draws a uniformly random k-subset of [0, n) in O(k) expected time
+	 using Floyd's algorithm. Positions are returned in ascending order. taken
+	 must hold n false flags; it is restored before returning. */
+std::vector<size_t> floyd_combination_(size_t n, size_t k, TRng &rng,
+																			 std::vector<bool> *taken) {
+	std::vector<size_t> drawn;
+	drawn.reserve(k);
+	for (size_t j = n - k; j < n; ++j) {
+		size_t t = std::uniform_int_distribution<size_t>(0, j)(rng);
+		// every chosen position is < j
+		if ((*taken)[t]) t = j;
+		(*taken)[t] = true;
+		drawn.push_back(t);
+	}
+	for (size_t position : drawn) (*taken)[position] = false;
+
+	// a uniform k-subset puts O(1) expected positions into each of k equal
+	// buckets, so a bucket pass followed by insertion sort is O(k) expected
+	size_t width = (n + k - 1) / k;
+	std::vector<size_t> starts(k + 1);
+	for (size_t position : drawn) ++starts[position / width + 1];
+	std::partial_sum(starts.begin(), starts.end(), starts.begin());
+	std::vector<size_t> positions(k);
+	for (size_t position : drawn) positions[starts[position / width]++] = position;
+	for (size_t i = 1; i < k; ++i) {
+		size_t position = positions[i];
+		size_t j = i;
+		for (; j > 0 && positions[j - 1] > position; --j) {
+			positions[j] = positions[j - 1];
+		}
+		positions[j] = position;
+	}
+	return positions;
+}
+
+template <typename TRng>
+/** @brief Draws a uniformly random k-permutation of [0, n) in O(k) time using
+	 Floyd's permutation variant. The order is kept as a linked list in next,
+	 which must hold n copies of SIZE_MAX; it is restored before returning. */
+std::vector<size_t> floyd_permutation_(size_t n, size_t k, TRng &rng,
+																			 std::vector<size_t> *next) {
+	constexpr size_t unchosen = std::numeric_limits<size_t>::max();
+	// n marks the end of the list
+	size_t head = n;
+	for (size_t j = n - k; j < n; ++j) {
+		size_t t = std::uniform_int_distribution<size_t>(0, j)(rng);
+		if ((*next)[t] == unchosen) {
+			// new position goes to the front
+			(*next)[t] = head;
+			head = t;
+		} else {
+			// j goes directly after t (every chosen position is < j)
+			(*next)[j] = (*next)[t];
+			(*next)[t] = j;
+		}
+	}
+	std::vector<size_t> positions(k);
+	for (size_t i = 0; i < k; ++i) {
+		positions[i] = head;
+		head = (*next)[head];
+		(*next)[positions[i]] = unchosen;
+	}
+	return positions;
+}
+
+template <typename T, typename TDraw>
+/** @brief Collects count samples of target positions produced by draw into
+	 containers of target values, optionally rejecting repeated samples. */
+std::vector<T> collect_samples_(const T &target, size_t count, bool distinct,
+																const TDraw &draw) {
+	using TargetCit = typename T::const_iterator;
+
+	// index the target once so that non-random-access targets cost O(k) per
+	// sample
+	std::vector<TargetCit> cits;
+	cits.reserve(target.size());
+	for (auto cit = target.cbegin(); cit != target.cend(); ++cit) {
+		cits.push_back(cit);
+	}
+
+	//                Result goes here
+	std::vector<T> result;
+	//                ----------------
+	result.reserve(count);
+
+	std::set<std::vector<size_t>> seen;
+	while (result.size() < count) {
+		std::vector<size_t> positions = draw();
+		if (distinct && !seen.insert(positions).second) continue;
+		// create subresult
+		T subresult;
+		// fill subresult with the values at each position
+		std::back_insert_iterator out(subresult);
+		for (size_t position : positions) *out++ = *cits[position];
+		// store the subresult in the results
+		result.push_back(subresult);
+	}
+
+	return result;
+}
+
+template <typename TCount>
+/** @brief Returns true if at least count samples exist, given a callable that
+	 counts them (and throws "EOverflow" when they exceed size_t). */
+bool has_n_samples_(size_t count, const TCount &n_samples) {
+	try {
+		return count <= n_samples();
+	} catch (const char *) {
+		return true;
+	}
+}
+
+}	// namespace internal
+
+template <typename T, typename TRng,
+					std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Draws count uniformly random combinations of the values in a
+ * container T without enumerating the combination space. Each draw uses
+ * Floyd's algorithm (sample_sz random numbers), so the total expected cost is
+ * O(target.size() + count * sample_sz) regardless of C(target.size(),
+ * sample_sz), plus the cost of rejecting repeats when distinct is set.
+ * Samples keep target order, like combinate.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from
+ * @param count Number of samples to draw
+ * @param rng Uniform random bit generator (e.g. std::mt19937_64)
+ * @param distinct Whether or not every sample must be different; throws
+ *                 "ESampleCount" if count exceeds the number of combinations
+ * @return std::vector<T>
+ */
+std::vector<T> sample_combinations(const T &target, size_t sample_sz,
+																	 size_t count, TRng &&rng, bool distinct) {
+	// check assertions / errors
+	assert(sample_sz > 0 && sample_sz <= target.size());
+	if (distinct && !internal::has_n_samples_(count, [&] {
+				return n_combinations(target.size(), sample_sz);
+			})) {
+		throw "ESampleCount";
+	}
+
+	std::vector<bool> taken(target.size());
+	return internal::collect_samples_(target, count, distinct, [&] {
+		return internal::floyd_combination_(target.size(), sample_sz, rng,
+																				&taken);
+	});
+}
+
+template <typename T, typename TRng,
+					std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Draws count uniformly random permutations of the values in a
+ * container T without enumerating the permutation space. Each draw uses
+ * Floyd's permutation algorithm (or sample_sz independent picks with
+ * repetition), so the total cost is O(target.size() + count * sample_sz),
+ * plus the cost of rejecting repeats when distinct is set.
+ *
+ * @param target Target container
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param count Number of samples to draw
+ * @param rng Uniform random bit generator (e.g. std::mt19937_64)
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @param distinct Whether or not every sample must be different; throws
+ *                 "ESampleCount" if count exceeds the number of permutations
+ * @return std::vector<T>
+ */
+std::vector<T> sample_permutations(const T &target, size_t sample_sz,
+																	 size_t count, TRng &&rng, bool repetition,
+																	 bool distinct) {
+	// check assertions
+	assert(sample_sz <= target.size() || repetition);
+
+	// handle default value
+	if (sample_sz == 0) sample_sz = target.size();
+
+	if (distinct && !internal::has_n_samples_(count, [&] {
+				return n_permutations(target.size(), sample_sz, repetition);
+			})) {
+		throw "ESampleCount";
+	}
+
+	std::vector<size_t> next;
+	if (!repetition) {
+		next.assign(target.size(), std::numeric_limits<size_t>::max());
+	}
+	return internal::collect_samples_(target, count, distinct, [&] {
+		if (!repetition) {
+			return internal::floyd_permutation_(target.size(), sample_sz, rng,
+																					&next);
+		}
+		std::vector<size_t> positions(sample_sz);
+		std::uniform_int_distribution<size_t> pick(0, target.size() - 1);
+		for (size_t &position : positions) position = pick(rng);
+		return positions;
+	});
+}
+
+/* .--------------------------------------------------------------------------,
+	/                         ccutl::cartesian_product                         /
+ '--------------------------------------------------------------------------' */
+
+template <typename... TContainers>
+/** @brief Lazy range over the cartesian product of one or more containers
+	 (see cartesian_product). */
+class cartesian_product_range {
+	static_assert(sizeof...(TContainers) > 0,
+								"cartesian_product requires at least one container");
+
+ public:
+	using iterator_tuple = std::tuple<typename TContainers::const_iterator...>;
+	using reference_tuple = std::tuple<typename std::iterator_traits<
+			typename TContainers::const_iterator>::reference...>;
+
+	/** @brief Input iterator that steps to the next tuple. The last container
+		 moves fastest, as in nested loops. */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = reference_tuple;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at a given tuple of positions. */
+		iterator(const cartesian_product_range *range, iterator_tuple current)
+				: range_(range), current_(current), done_(range->empty()) {}
+
+		/** @brief Returns a tuple of references to the current values. */
+		reference operator*() const {
+			return std::apply(
+					[](const auto &... cits) { return reference(*cits...); }, current_);
+		}
+
+		/** @brief Returns the current iterator of each container. */
+		const iterator_tuple &iterators() const { return current_; }
+
+		iterator &operator++() {
+			step<sizeof...(TContainers) - 1>();
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || current_ == rhs.current_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		const cartesian_product_range *range_ = nullptr;
+		// current iterator of each container
+		iterator_tuple current_;
+		// whether or not every tuple has been visited
+		bool done_ = true;
+
+		// counts in mixed radix: advance container I, carrying into I - 1
+		template <size_t I>
+		void step() {
+			auto &cit = std::get<I>(current_);
+			if (++cit != std::get<I>(range_->containers_)->cend()) return;
+			cit = std::get<I>(range_->containers_)->cbegin();
+			if constexpr (I == 0) {
+				done_ = true;
+			} else {
+				step<I - 1>();
+			}
+		}
+	};
+
+	explicit cartesian_product_range(const TContainers &... containers)
+			: containers_(&containers...) {}
+
+	iterator begin() const {
+		return iterator(this, std::apply(
+															[](const auto *... containers) {
+																return iterator_tuple(containers->cbegin()...);
+															},
+															containers_));
+	}
+	iterator end() const { return iterator(); }
+
+	/** @brief Returns whether there are no tuples (any container is empty).
+		 Unlike size(), this never throws. */
+	bool empty() const {
+		return std::apply(
+				[](const auto *... containers) {
+					return (std::empty(*containers) || ...);
+				},
+				containers_);
+	}
+
+	/** @brief Returns the number of tuples. Throws "EOverflow" if it does not
+		 fit in a size_t; iteration does not need it, so products of any size can
+		 be walked from begin(). */
+	size_t size() const {
+		return std::apply(
+				[](const auto *... containers) {
+					size_t result = 1;
+					(safe_mul(&result, containers->size()), ...);
+					return result;
+				},
+				containers_);
+	}
+
+	/** @brief Returns an iterator at the tuple of the given rank (its index in
+		 iteration order). Throws "EOverflow" if the product does not fit in a
+		 size_t. */
+	iterator at(size_t rank) const {
+		assert(rank < size());
+		iterator_tuple current;
+		unrank<sizeof...(TContainers) - 1>(rank, &current);
+		return iterator(this, current);
+	}
+
+ private:
+	std::tuple<const TContainers *...> containers_;
+
+	template <size_t I>
+	void unrank(size_t rank, iterator_tuple *current) const {
+		const auto *container = std::get<I>(containers_);
+		std::get<I>(*current) = std::next(
+				container->cbegin(),
+				static_cast<std::ptrdiff_t>(rank % container->size()));
+		if constexpr (I != 0) unrank<I - 1>(rank / container->size(), current);
+	}
+};
+
+template <typename... TContainers,
+					std::enable_if_t<are_const_iterable_v<TContainers...>> *>
+/**
+ * @brief Returns a lazy range over the cartesian product of one or more
+ * (possibly heterogeneous) containers. Iteration yields a tuple of references
+ * to the current values; the last container moves fastest, as in nested loops.
+ * Each container contributes its own radix, so sizes may differ.
+ *
+ * @param containers Containers to combine (must outlive the range)
+ * @return cartesian_product_range<TContainers...>
+ */
+cartesian_product_range<TContainers...> cartesian_product(
+		const TContainers &... containers) {
+	return cartesian_product_range<TContainers...>(containers...);
+}
+
+template <typename TExecutionPolicy, typename... TContainers,
+					typename TUnaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy>> *>
+/**
+ * @brief Calls f with the reference tuple of every element of a cartesian
+ * product, enumerating chunks of the rank space using an execution policy.
+ * Chunks start at range.at(first), so each thread walks its own slice.
+ *
+ * @param policy Execution policy
+ * @param range Cartesian product range
+ * @param f Unary operation taking a reference tuple
+ */
+void for_each_product(TExecutionPolicy &&policy,
+											const cartesian_product_range<TContainers...> &range,
+											const TUnaryOp &f) {
+	internal::for_each_chunk_(policy, range.size(),
+														[&](size_t first, size_t last) {
+															auto it = range.at(first);
+															for (size_t i = first; i < last; ++i, ++it) {
+																f(*it);
+															}
+														});
+}
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::next_batch                             /
+ '--------------------------------------------------------------------------' */
+
+template <typename TRange>
+/**
+ * @brief Collects up to batch_sz samples from an enumeration range into
+ * containers of the range's target type, advancing the iterator past them.
+ * Together with the range's checkpoint / resume this allows an enumeration to
+ * be emitted in bounded batches and restarted after the last finished batch.
+ *
+ * @param range Enumeration range (e.g. from lazy_combinate / lazy_permutate)
+ * @param it Iterator of range to continue from; updated in place
+ * @param batch_sz Maximum number of samples to collect
+ * @return std::vector<typename TRange::target_type>
+ */
+std::vector<typename TRange::target_type> next_batch(
+		const TRange &range, typename TRange::iterator *it, size_t batch_sz) {
+	//                Result goes here
+	std::vector<typename TRange::target_type> result;
+	//                ----------------
+	result.reserve(batch_sz);
+
+	for (; result.size() < batch_sz && *it != range.end(); ++*it) {
+		// store the subresult in the results
+		result.push_back(
+				internal::make_subresult_<typename TRange::target_type>(**it));
+	}
+
+	return result;
+}
+
+/* .--------------------------------------------------------------------------,
+	/                              ccutl::subsets                              /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+/** @brief Lazy range over all subsets of the values in a container T whose
+	 sizes are within [lo, hi] (see subsets). */
+class subset_range {
+ public:
+	using target_type = T;
+	using TargetCit = typename T::const_iterator;
+
+	/** @brief Input iterator that steps the sample to the next subset.
+		 Dereferencing yields a sample_view that is invalidated by the next step.
+	 */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sample_view<TargetCit>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first subset of a given size. */
+		iterator(const T &target, size_t sample_sz, size_t hi)
+				: target_(&target), sample_sz_(sample_sz), hi_(hi), done_(false) {
+			if (sample_sz_ != 0) {
+				comb_ = typename combination_range<T>::iterator(target, sample_sz_);
+			}
+		}
+
+		/** @brief Constructs an iterator at the subset of the given ascending
+			 target positions. */
+		iterator(const T &target, const std::vector<size_t> &positions, size_t hi)
+				: target_(&target),
+					sample_sz_(positions.size()),
+					hi_(hi),
+					done_(false) {
+			if (sample_sz_ != 0) {
+				comb_ = typename combination_range<T>::iterator(target, positions);
+			}
+		}
+
+		reference operator*() const {
+			if (sample_sz_ == 0) return value_type(nullptr, nullptr);
+			return *comb_;
+		}
+
+		iterator &operator++() {
+			using TCombIt = typename combination_range<T>::iterator;
+			if (sample_sz_ != 0) ++comb_;
+			if (sample_sz_ == 0 || comb_ == TCombIt()) {
+				// move on to the next size
+				if (sample_sz_ == hi_) {
+					done_ = true;
+				} else {
+					*this = iterator(*target_, sample_sz_ + 1, hi_);
+				}
+			}
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ &&
+						 (done_ || (sample_sz_ == rhs.sample_sz_ && comb_ == rhs.comb_));
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		const T *target_ = nullptr;
+		// size of the current subset
+		size_t sample_sz_ = 0;
+		// largest subset size
+		size_t hi_ = 0;
+		// current combination of the current size (unused for the empty subset)
+		typename combination_range<T>::iterator comb_;
+		// whether or not every subset has been visited
+		bool done_ = true;
+	};
+
+	subset_range(const T &target, size_t lo, size_t hi)
+			: target_(&target), lo_(lo), hi_(hi) {}
+
+	iterator begin() const { return iterator(*target_, lo_, hi_); }
+	iterator end() const { return iterator(); }
+
+	/** @brief Returns the number of subsets. Throws "EOverflow" if it does not
+		 fit in a size_t. */
+	size_t size() const {
+		size_t result = 0;
+		for (size_t sample_sz = lo_; sample_sz <= hi_; ++sample_sz) {
+			safe_add(&result, n_combinations(target_->size(), sample_sz));
+		}
+		return result;
+	}
+
+	/** @brief Returns an iterator at the subset of the given rank (its index in
+		 iteration order). */
+	iterator at(size_t rank) const {
+		for (size_t sample_sz = lo_; sample_sz <= hi_; ++sample_sz) {
+			size_t n_sized = n_combinations(target_->size(), sample_sz);
+			if (rank < n_sized) {
+				if (sample_sz == 0) return iterator(*target_, 0, hi_);
+				return iterator(
+						*target_, combination_unrank(rank, target_->size(), sample_sz),
+						hi_);
+			}
+			rank -= n_sized;
+		}
+		return end();
+	}
+
+ private:
+	const T *target_;
+	size_t lo_;
+	size_t hi_;
+};
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Returns a lazy range over all subsets of the values in a container T
+ * with between lo and hi values (the power set for 0 and target.size()).
+ * Subsets are produced by size, and within a size in the same order as
+ * combinate, using the same sample stepping. Nothing is materialized. Small
+ * random-access targets are not stepped as masks (see subsets_mask): each
+ * mask would have to be expanded back into the sample, which is slower than
+ * stepping it (see the subsets / subsets_mask cases of
+ * bench/combinatorics.cc).
+ *
+ * @param target Target container
+ * @param lo Smallest subset size
+ * @param hi Largest subset size
+ * @return subset_range<T>
+ */
+subset_range<T> subsets(const T &target, size_t lo, size_t hi) {
+	assert(lo <= hi && hi <= target.size());
+	return subset_range<T>(target, lo, hi);
+}
+
+/** @brief Lazy range over all subsets of n_avail <= 64 positions with sizes
+	 within [lo, hi], as uint64_t masks (see subsets_mask). */
+class subset_mask_range {
+ public:
+	/** @brief Input iterator over subset masks. */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = uint64_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const uint64_t *;
+		using reference = const uint64_t &;
+
+		/** @brief Constructs the end iterator. */
+		iterator() = default;
+
+		/** @brief Constructs an iterator at the first subset mask of a given
+			 size. */
+		iterator(size_t n_avail, size_t sample_sz, size_t hi)
+				: comb_(n_avail, sample_sz),
+					n_avail_(n_avail),
+					sample_sz_(sample_sz),
+					hi_(hi),
+					done_(false) {}
+
+		reference operator*() const { return *comb_; }
+
+		iterator &operator++() {
+			++comb_;
+			if (comb_ == combination_mask_range::iterator()) {
+				// move on to the next size
+				if (sample_sz_ == hi_) {
+					done_ = true;
+				} else {
+					*this = iterator(n_avail_, sample_sz_ + 1, hi_);
+				}
+			}
+			return *this;
+		}
+
+		bool operator==(const iterator &rhs) const {
+			return done_ == rhs.done_ && (done_ || comb_ == rhs.comb_);
+		}
+		bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+
+	 private:
+		// current combination mask of the current size
+		combination_mask_range::iterator comb_;
+		size_t n_avail_ = 0;
+		// size of the current subset
+		size_t sample_sz_ = 0;
+		// largest subset size
+		size_t hi_ = 0;
+		// whether or not every subset has been visited
+		bool done_ = true;
+	};
+
+	subset_mask_range(size_t n_avail, size_t lo, size_t hi)
+			: n_avail_(n_avail), lo_(lo), hi_(hi) {}
+
+	iterator begin() const { return iterator(n_avail_, lo_, hi_); }
+	iterator end() const { return iterator(); }
+
+ private:
+	size_t n_avail_;
+	size_t lo_;
+	size_t hi_;
+};
+
+/** @brief Returns a lazy range over all subsets of n_avail <= 64 positions with
+	 between lo and hi members as uint64_t masks, in subsets order, using the
+	 combinate_mask kernel for each size. Meant for callers that only need
+	 membership; use subsets for the values. */
+inline subset_mask_range subsets_mask(size_t n_avail, size_t lo, size_t hi) {
+	assert(n_avail <= 64);
+	assert(lo <= hi && hi <= n_avail);
+	return subset_mask_range(n_avail, lo, hi);
+}
+
+template <typename TExecutionPolicy, typename T, typename TUnaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy>> *>
+/**
+ * @brief Calls f with a sample_view of every subset of a subset range,
+ * enumerating chunks of the rank space using an execution policy. Chunks start
+ * at range.at(first), so each thread steps its own slice.
+ *
+ * @param policy Execution policy
+ * @param range Subset range
+ * @param f Unary operation taking a sample_view
+ */
+void for_each_subset(TExecutionPolicy &&policy, const subset_range<T> &range,
+										 const TUnaryOp &f) {
+	internal::for_each_chunk_(policy, range.size(),
+														[&](size_t first, size_t last) {
+															auto it = range.at(first);
+															for (size_t i = first; i < last; ++i, ++it) {
+																f(*it);
+															}
+														});
 }
 
 }	// namespace ccutl
@@ -22,19 +22,23 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-07-09
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
 #include "ccutl/algorithm.h"
 #include "ccutl/compare.h"
 #include "ccutl/convert.h"
+#include "ccutl/executor.h"
 #include "ccutl/format.h"
+#include "ccutl/generator.h"
 #include "ccutl/io.h"
 #include "ccutl/limits.h"
 #include "ccutl/macros.h"
 #include "ccutl/maps.h"
 #include "ccutl/math.h"
+#include "ccutl/pipeline.h"
+#include "ccutl/simd.h"
 #include "ccutl/type_traits.h"
 
 #endif	// CPPUTILS_CCUTL_CCUTL_ALL_H_
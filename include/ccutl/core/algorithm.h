@@ -22,18 +22,33 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-06-28
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
+#include <cstdint>
 #include <execution>
+#include <iterator>
 #include <type_traits>
 
 #include "ccutl/core/compare.h"
+#include "ccutl/core/executor.h"
+#include "ccutl/core/simd.h"
 #include "ccutl/core/type_traits.h"
 
 namespace ccutl {
 
+/* .--------------------------------------------------------------------------,
+	/                                ccutl::zip                                /
+ '--------------------------------------------------------------------------' */
+
+template <typename... TContainers>
+class zip_view;
+
+template <typename... TContainers,
+					std::enable_if_t<are_const_iterable_v<TContainers...>> * = nullptr>
+zip_view<TContainers...> zip(const TContainers &... containers);
+
 /* .--------------------------------------------------------------------------,
 	/                           ccutl::transform_it                            /
  '--------------------------------------------------------------------------' */
@@ -49,10 +64,10 @@ template <bool BackInsert = false, typename TExecutionPolicy,
 					typename TInputContainer, typename TOutputContainer,
 					typename TUnaryOp,
 					std::enable_if_t<
-							std::is_execution_policy_v<decay_deep_t<TExecutionPolicy>> &&
+							is_parallel_policy_v<TExecutionPolicy> &&
 							are_const_iterable_v<TInputContainer> &&
 							are_iterable_v<TOutputContainer>> * = nullptr>
-auto transform_it(const TExecutionPolicy &&policy, const TInputContainer &input,
+auto transform_it(TExecutionPolicy &&policy, const TInputContainer &input,
 									TOutputContainer *output, const TUnaryOp &f);
 
 template <
@@ -68,14 +83,28 @@ template <bool BackInsert = false, typename TExecutionPolicy,
 					typename TInputContainer1, typename TInputContainer2,
 					typename TOutputContainer, typename TUnaryOp,
 					std::enable_if_t<
-							std::is_execution_policy_v<decay_deep_t<TExecutionPolicy>> &&
+							is_parallel_policy_v<TExecutionPolicy> &&
 							are_const_iterable_v<TInputContainer1, TInputContainer2> &&
 							are_iterable_v<TOutputContainer>> * = nullptr>
-auto transform_it(const TExecutionPolicy &&policy,
-									const TInputContainer1 &input1,
+auto transform_it(TExecutionPolicy &&policy, const TInputContainer1 &input1,
 									const TInputContainer2 &input2, TOutputContainer *output,
 									const TUnaryOp &f);
 
+template <bool BackInsert = false, typename... TInputContainers,
+					typename TOutputContainer, typename TNaryOp,
+					std::enable_if_t<are_iterable_v<TOutputContainer>> * = nullptr>
+auto transform_it(const zip_view<TInputContainers...> &inputs,
+									TOutputContainer *output, const TNaryOp &f);
+
+template <bool BackInsert = false, typename TExecutionPolicy,
+					typename... TInputContainers, typename TOutputContainer,
+					typename TNaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy> &&
+													 are_iterable_v<TOutputContainer>> * = nullptr>
+auto transform_it(TExecutionPolicy &&policy,
+									const zip_view<TInputContainers...> &inputs,
+									TOutputContainer *output, const TNaryOp &f);
+
 /* .--------------------------------------------------------------------------,
 	/                            ccutl::for_each_it                            /
  '--------------------------------------------------------------------------' */
@@ -84,12 +113,12 @@ template <typename TInputContainer, typename TUnaryOp,
 					std::enable_if_t<are_const_iterable_v<TInputContainer>> * = nullptr>
 TUnaryOp for_each_it(const TInputContainer &input, const TUnaryOp &f);
 
-template <typename TExecutionPolicy, typename TInputContainer, typename T,
+template <typename TExecutionPolicy, typename TInputContainer,
 					typename TUnaryOp,
 					std::enable_if_t<
-							std::is_execution_policy_v<decay_deep_t<TExecutionPolicy>> &&
+							is_parallel_policy_v<TExecutionPolicy> &&
 							are_const_iterable_v<TInputContainer>> * = nullptr>
-void for_each_it(const TExecutionPolicy &&policy, const TInputContainer &input,
+void for_each_it(TExecutionPolicy &&policy, const TInputContainer &input,
 								 const TUnaryOp &f);
 
 /* .--------------------------------------------------------------------------,
@@ -105,43 +134,44 @@ constexpr bool iterate_it_unary_should_enable_v_ = ([]() constexpr->bool {
 	if constexpr (Reverse ? !are_const_reverse_iterable_v<TInputContainer>
 												: !are_const_iterable_v<TInputContainer>) {
 		return false;
-	}
-	using InputItT =
-			std::conditional_t<Reverse,
-												 decltype(std::declval<TInputContainer>().crbegin()),
-												 decltype(std::declval<TInputContainer>().cbegin())>;
-	if constexpr (NArgs == 1) {
-		if constexpr (std::is_invocable_v<TUnaryOp, InputItT>) {
-			using FunctorReturnT = functor_return_type_t<TUnaryOp, InputItT>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputItT, FunctorReturnT>;
+	} else {
+		using InputItT =
+				std::conditional_t<Reverse,
+													 decltype(std::declval<TInputContainer>().crbegin()),
+													 decltype(std::declval<TInputContainer>().cbegin())>;
+		if constexpr (NArgs == 1) {
+			if constexpr (std::is_invocable_v<TUnaryOp, InputItT>) {
+				using FunctorReturnT = functor_return_type_t<TUnaryOp, InputItT>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputItT, FunctorReturnT>;
+				}
 			}
-		}
-		return false;
-	} else if constexpr (NArgs == 2) {
-		if constexpr (std::is_invocable_v<TUnaryOp, InputItT, InputItT>) {
-			using FunctorReturnT =
-					functor_return_type_t<TUnaryOp, InputItT, InputItT>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputItT, FunctorReturnT>;
+			return false;
+		} else if constexpr (NArgs == 2) {
+			if constexpr (std::is_invocable_v<TUnaryOp, InputItT, InputItT>) {
+				using FunctorReturnT =
+						functor_return_type_t<TUnaryOp, InputItT, InputItT>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputItT, FunctorReturnT>;
+				}
 			}
-		}
-		return false;
-	} else {
-		if constexpr (std::is_invocable_v<TUnaryOp, InputItT, InputItT, InputItT>) {
-			using FunctorReturnT =
-					functor_return_type_t<TUnaryOp, InputItT, InputItT, InputItT>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputItT, FunctorReturnT>;
+			return false;
+		} else {
+			if constexpr (std::is_invocable_v<TUnaryOp, InputItT, InputItT, InputItT>) {
+				using FunctorReturnT =
+						functor_return_type_t<TUnaryOp, InputItT, InputItT, InputItT>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputItT, FunctorReturnT>;
+				}
 			}
+			return false;
 		}
-		return false;
 	}
 })();
 
@@ -156,78 +186,79 @@ constexpr bool iterate_it_binary_should_enable_v_ = ([]() constexpr->bool {
 												: (!are_const_iterable_v<TInputContainer1> ||
 													 !are_const_iterable_v<TInputContainer2>)) {
 		return false;
-	}
-	using InputIt1T =
-			std::conditional_t<Reverse,
-												 decltype(std::declval<TInputContainer1>().crbegin()),
-												 decltype(std::declval<TInputContainer1>().cbegin())>;
-	using InputIt2T =
-			std::conditional_t<Reverse,
-												 decltype(std::declval<TInputContainer2>().crbegin()),
-												 decltype(std::declval<TInputContainer2>().cbegin())>;
-	if constexpr (NArgs == 2) {
-		if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T>) {
-			using FunctorReturnT =
-					functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputIt1T, FunctorReturnT>;
+	} else {
+		using InputIt1T =
+				std::conditional_t<Reverse,
+													 decltype(std::declval<TInputContainer1>().crbegin()),
+													 decltype(std::declval<TInputContainer1>().cbegin())>;
+		using InputIt2T =
+				std::conditional_t<Reverse,
+													 decltype(std::declval<TInputContainer2>().crbegin()),
+													 decltype(std::declval<TInputContainer2>().cbegin())>;
+		if constexpr (NArgs == 2) {
+			if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T>) {
+				using FunctorReturnT =
+						functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputIt1T, FunctorReturnT>;
+				}
 			}
-		}
-		return false;
-	} else if constexpr (NArgs == 3) {
-		if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
-																			InputIt1T>) {
-			using FunctorReturnT =
-					functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputIt1T, FunctorReturnT>;
+			return false;
+		} else if constexpr (NArgs == 3) {
+			if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
+																				InputIt1T>) {
+				using FunctorReturnT =
+						functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputIt1T, FunctorReturnT>;
+				}
 			}
-		}
-		return false;
-	} else if constexpr (NArgs == 4) {
-		if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
-																			InputIt1T, InputIt2T>) {
-			using FunctorReturnT =
-					functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T,
-																InputIt2T>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputIt1T, FunctorReturnT>;
+			return false;
+		} else if constexpr (NArgs == 4) {
+			if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
+																				InputIt1T, InputIt2T>) {
+				using FunctorReturnT =
+						functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T,
+																	InputIt2T>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputIt1T, FunctorReturnT>;
+				}
 			}
-		}
-		return false;
-	} else if constexpr (NArgs == 5) {
-		if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
-																			InputIt1T, InputIt2T, InputIt1T>) {
-			using FunctorReturnT =
-					functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T,
-																InputIt2T, InputIt1T>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputIt1T, FunctorReturnT>;
+			return false;
+		} else if constexpr (NArgs == 5) {
+			if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
+																				InputIt1T, InputIt2T, InputIt1T>) {
+				using FunctorReturnT =
+						functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T,
+																	InputIt2T, InputIt1T>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputIt1T, FunctorReturnT>;
+				}
 			}
-		}
-		return false;
-	} else {
-		if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
-																			InputIt1T, InputIt2T, InputIt1T,
-																			InputIt2T>) {
-			using FunctorReturnT =
-					functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T,
-																InputIt2T, InputIt1T, InputIt2T>;
-			if constexpr (ShouldReturnVoid) {
-				return are_decay_same_v<void, FunctorReturnT>;
-			} else {
-				return are_decay_same_v<InputIt1T, FunctorReturnT>;
+			return false;
+		} else {
+			if constexpr (std::is_invocable_v<TBinaryOp, InputIt1T, InputIt2T,
+																				InputIt1T, InputIt2T, InputIt1T,
+																				InputIt2T>) {
+				using FunctorReturnT =
+						functor_return_type_t<TBinaryOp, InputIt1T, InputIt2T, InputIt1T,
+																	InputIt2T, InputIt1T, InputIt2T>;
+				if constexpr (ShouldReturnVoid) {
+					return are_decay_same_v<void, FunctorReturnT>;
+				} else {
+					return are_decay_same_v<InputIt1T, FunctorReturnT>;
+				}
 			}
+			return false;
 		}
-		return false;
 	}
 })();
 
@@ -347,6 +378,16 @@ template <bool Reverse = false, typename TInputContainer1,
 void iterate_it(const TInputContainer1 &input1, const TInputContainer2 &input2,
 								const TBinaryOp &f);
 
+template <bool Reverse = false, typename... TInputContainers,
+					typename TNaryOp>
+void iterate_it(const zip_view<TInputContainers...> &inputs, const TNaryOp &f);
+
+template <typename TExecutionPolicy, typename... TInputContainers,
+					typename TNaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy>> * = nullptr>
+void iterate_it(TExecutionPolicy &&policy,
+								const zip_view<TInputContainers...> &inputs, const TNaryOp &f);
+
 /* .--------------------------------------------------------------------------,
 	/                              ccutl::concat                               /
  '--------------------------------------------------------------------------' */
@@ -388,21 +429,246 @@ template <
 										 are_streamable_to_v<std::ostream, TVal, TDelim>> * = nullptr>
 std::string join(const TContain<TVal> &target, const TDelim &delimiter = "");
 
+/* .--------------------------------------------------------------------------,
+	/                  ccutl::n_combinations / n_permutations                  /
+ '--------------------------------------------------------------------------' */
+
+inline constexpr size_t n_combinations(size_t n_avail, size_t sample_sz);
+
+inline constexpr size_t n_permutations(size_t n_avail, size_t sample_sz = 0,
+																				bool repetition = false);
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::sample_view                            /
+ '--------------------------------------------------------------------------' */
+
+template <typename TargetCit>
+class sample_view;
+
 /* .--------------------------------------------------------------------------,
 	/                             ccutl::combinate                             /
  '--------------------------------------------------------------------------' */
 
+template <typename T>
+class combination_range;
+
 template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
 std::vector<T> combinate(const T &target, size_t sample_sz);
 
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> * = nullptr>
+std::vector<T> combinate(TExecutionPolicy &&policy, const T &target,
+												 size_t sample_sz);
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+combination_range<T> lazy_combinate(const T &target, size_t sample_sz);
+
+template <typename T, typename TUnaryOp,
+					std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+bool for_each_combination(const T &target, size_t sample_sz,
+													const TUnaryOp &f);
+
+inline size_t combination_rank(const std::vector<size_t> &positions,
+															 size_t n_avail);
+
+inline std::vector<size_t> combination_unrank(size_t rank, size_t n_avail,
+																							size_t sample_sz);
+
+/* .--------------------------------------------------------------------------,
+	/                          ccutl::combinate_mask                           /
+ '--------------------------------------------------------------------------' */
+
+class combination_mask_range;
+
+inline combination_mask_range combinate_mask(size_t n_avail, size_t sample_sz);
+
+/* .--------------------------------------------------------------------------,
+	/                     ccutl::revolving_door_combinate                      /
+ '--------------------------------------------------------------------------' */
+
+namespace internal {
+
+/** @brief Whether or not the const iterators of a container T can step
+	 backwards (revolving-door steps move sample positions both ways). */
+template <typename T>
+inline constexpr bool has_bidirectional_ = ([]() constexpr->bool {
+	if constexpr (!are_const_iterable_v<T>) {
+		return false;
+	} else {
+		return std::is_base_of_v<std::bidirectional_iterator_tag,
+														 typename std::iterator_traits<
+																 typename T::const_iterator>::iterator_category>;
+	}
+})();
+
+}	// namespace internal
+
+template <typename T>
+class revolving_door_range;
+
+template <typename T,
+					std::enable_if_t<internal::has_bidirectional_<T>> * = nullptr>
+revolving_door_range<T> revolving_door_combinate(const T &target,
+																								 size_t sample_sz);
+
 /* .--------------------------------------------------------------------------,
 	/                             ccutl::permutate                             /
  '--------------------------------------------------------------------------' */
 
+template <typename T>
+class permutation_range;
+
 template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
 std::vector<T> permutate(const T &target, size_t sample_sz = 0,
 												 bool repetition = false);
 
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> * = nullptr>
+std::vector<T> permutate(TExecutionPolicy &&policy, const T &target,
+												 size_t sample_sz = 0, bool repetition = false);
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+permutation_range<T> lazy_permutate(const T &target, size_t sample_sz = 0,
+																		bool repetition = false);
+
+template <typename T, typename TUnaryOp,
+					std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+bool for_each_permutation(const T &target, size_t sample_sz, bool repetition,
+													const TUnaryOp &f);
+
+template <typename T>
+class swap_permutation_range;
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+swap_permutation_range<T> swap_permutate(const T &target);
+
+template <typename T>
+class multiset_permutation_range;
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+multiset_permutation_range<T> lazy_multiset_permutate(const T &target,
+																											size_t sample_sz = 0);
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+std::vector<T> multiset_permutate(const T &target, size_t sample_sz = 0);
+
+inline size_t permutation_rank(const std::vector<size_t> &positions,
+															 size_t n_avail, bool repetition = false);
+
+inline std::vector<size_t> permutation_unrank(size_t rank, size_t n_avail,
+																							size_t sample_sz,
+																							bool repetition = false);
+
+/* .--------------------------------------------------------------------------,
+	/                           ccutl::flat_samples                            /
+ '--------------------------------------------------------------------------' */
+
+template <typename TValue>
+class flat_samples;
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+flat_samples<typename T::value_type> combinate_flat(const T &target,
+																										size_t sample_sz);
+
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> * = nullptr>
+flat_samples<typename T::value_type> combinate_flat(TExecutionPolicy &&policy,
+																										const T &target,
+																										size_t sample_sz);
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+flat_samples<typename T::value_type> permutate_flat(const T &target,
+																										size_t sample_sz = 0,
+																										bool repetition = false);
+
+template <typename TExecutionPolicy, typename T,
+					std::enable_if_t<
+							is_parallel_policy_v<TExecutionPolicy> &&
+							are_const_iterable_v<T>> * = nullptr>
+flat_samples<typename T::value_type> permutate_flat(TExecutionPolicy &&policy,
+																										const T &target,
+																										size_t sample_sz = 0,
+																										bool repetition = false);
+
+/* .--------------------------------------------------------------------------,
+	/               ccutl::combination_table / permutation_table               /
+ '--------------------------------------------------------------------------' */
+
+template <size_t N, size_t K>
+constexpr auto combination_table();
+
+template <size_t N, size_t K = N, bool Repetition = false>
+constexpr auto permutation_table();
+
+/* .--------------------------------------------------------------------------,
+	/             ccutl::sample_combinations / sample_permutations             /
+ '--------------------------------------------------------------------------' */
+
+template <typename T, typename TRng,
+					std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+std::vector<T> sample_combinations(const T &target, size_t sample_sz,
+																	 size_t count, TRng &&rng,
+																	 bool distinct = false);
+
+template <typename T, typename TRng,
+					std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+std::vector<T> sample_permutations(const T &target, size_t sample_sz,
+																	 size_t count, TRng &&rng,
+																	 bool repetition = false,
+																	 bool distinct = false);
+
+/* .--------------------------------------------------------------------------,
+	/                         ccutl::cartesian_product                         /
+ '--------------------------------------------------------------------------' */
+
+template <typename... TContainers>
+class cartesian_product_range;
+
+template <typename... TContainers,
+					std::enable_if_t<are_const_iterable_v<TContainers...>> * = nullptr>
+cartesian_product_range<TContainers...> cartesian_product(
+		const TContainers &... containers);
+
+template <typename TExecutionPolicy, typename... TContainers,
+					typename TUnaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy>> * = nullptr>
+void for_each_product(TExecutionPolicy &&policy,
+											const cartesian_product_range<TContainers...> &range,
+											const TUnaryOp &f);
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::next_batch                             /
+ '--------------------------------------------------------------------------' */
+
+template <typename TRange>
+std::vector<typename TRange::target_type> next_batch(
+		const TRange &range, typename TRange::iterator *it, size_t batch_sz);
+
+/* .--------------------------------------------------------------------------,
+	/                              ccutl::subsets                              /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+class subset_range;
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+subset_range<T> subsets(const T &target, size_t lo, size_t hi);
+
+class subset_mask_range;
+
+inline subset_mask_range subsets_mask(size_t n_avail, size_t lo, size_t hi);
+
+template <typename TExecutionPolicy, typename T, typename TUnaryOp,
+					std::enable_if_t<is_parallel_policy_v<TExecutionPolicy>> * = nullptr>
+void for_each_subset(TExecutionPolicy &&policy, const subset_range<T> &range,
+										 const TUnaryOp &f);
+
 }	// namespace ccutl
 
 #endif	// CPPUTILS_CCUTL_CORE_ALGORITHM_H_
@@ -0,0 +1,71 @@
+#ifndef CPPUTILS_CCUTL_CORE_EXECUTOR_H_
+#define CPPUTILS_CCUTL_CORE_EXECUTOR_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/core/executor.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides a work-stealing thread pool usable as an execution policy.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <cstddef>
+#include <execution>
+#include <type_traits>
+
+#include "ccutl/core/type_traits.h"
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                        ccutl::work_stealing_pool                         /
+ '--------------------------------------------------------------------------' */
+
+class work_stealing_pool;
+
+inline work_stealing_pool &default_pool();
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::pool_policy                            /
+ '--------------------------------------------------------------------------' */
+
+/** @brief Policy tag that runs the parallel ccutl algorithms on a
+	 work_stealing_pool (the default pool if none is given). */
+struct pool_policy {
+	work_stealing_pool *pool = nullptr;
+
+	work_stealing_pool &get() const;
+};
+
+/** @brief Runs an algorithm on the default pool. */
+inline constexpr pool_policy pool_par{};
+
+template <typename T>
+inline constexpr bool is_pool_policy_v =
+		std::is_same_v<remove_everything_t<T>, pool_policy>;
+
+/** @brief Whether T is a standard execution policy or a pool_policy. */
+template <typename T>
+inline constexpr bool is_parallel_policy_v =
+		std::is_execution_policy_v<remove_everything_t<T>> || is_pool_policy_v<T>;
+
+}	// namespace ccutl
+
+#endif	// CPPUTILS_CCUTL_CORE_EXECUTOR_H_
@@ -0,0 +1,68 @@
+#ifndef CPPUTILS_CCUTL_CORE_GENERATOR_H_
+#define CPPUTILS_CCUTL_CORE_GENERATOR_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/core/generator.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides a C++20 coroutine generator and coroutine-based enumeration.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+// coroutine support requires C++20 (e.g. -std=c++20); without it this header
+// declares nothing and CCUTL_HAS_COROUTINES stays undefined
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && \
+		__has_include(<coroutine>)
+#ifndef CCUTL_HAS_COROUTINES
+#define CCUTL_HAS_COROUTINES
+#endif	// CCUTL_HAS_COROUTINES
+#endif
+
+#ifdef CCUTL_HAS_COROUTINES
+
+#include <type_traits>
+
+#include "ccutl/core/type_traits.h"
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                             ccutl::generator                             /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+class generator;
+
+/* .--------------------------------------------------------------------------,
+	/                    ccutl::co_combinate / co_permutate                    /
+ '--------------------------------------------------------------------------' */
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+generator<T> co_combinate(const T &target, size_t sample_sz);
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> * = nullptr>
+generator<T> co_permutate(const T &target, size_t sample_sz = 0,
+													bool repetition = false);
+
+}	// namespace ccutl
+
+#endif	// CCUTL_HAS_COROUTINES
+
+#endif	// CPPUTILS_CCUTL_CORE_GENERATOR_H_
@@ -22,7 +22,7 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-05-09
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
@@ -51,6 +51,10 @@ template <typename TLim, typename TA, typename TB,
 					std::enable_if_t<are_arithmetic_v<TLim, TA, TB>>* = nullptr>
 bool is_sub_overflow(TA a, TB b);
 
+template <typename TLim, typename TA, typename TB,
+					std::enable_if_t<are_arithmetic_v<TLim, TA, TB>>* = nullptr>
+constexpr bool is_mul_overflow(TA a, TB b);
+
 }	// namespace ccutl
 
 #endif	// CPPUTILS_CCUTL_CORE_LIMITS_H_
@@ -22,7 +22,7 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-07-09
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
@@ -41,6 +41,15 @@ template <typename TOutput, typename TAddend,
 							nullptr>
 void safe_add(TOutput* a, TAddend b);
 
+template <typename TResult, typename TA, typename TB,
+					std::enable_if_t<are_arithmetic_v<TResult, TA, TB>>* = nullptr>
+constexpr TResult safe_mul(TA a, TB b);
+
+template <typename TOutput, typename TMultiplier,
+					std::enable_if_t<are_arithmetic_v<remove_everything_t<TOutput>,
+																						TMultiplier>>* = nullptr>
+constexpr void safe_mul(TOutput* a, TMultiplier b);
+
 }	// namespace ccutl
 
 #endif	// CPPUTILS_CCUTL_CORE_MATH_H_
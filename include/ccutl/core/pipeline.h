@@ -0,0 +1,106 @@
+#ifndef CPPUTILS_CCUTL_CORE_PIPELINE_H_
+#define CPPUTILS_CCUTL_CORE_PIPELINE_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/core/pipeline.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides lazy transform pipelines that fuse their stages into a single
+ * pass.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <execution>
+#include <iterator>
+#include <type_traits>
+
+#include "ccutl/core/executor.h"
+#include "ccutl/core/type_traits.h"
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                             ccutl::pipeline                              /
+ '--------------------------------------------------------------------------' */
+
+namespace internal {
+
+template <typename TUnaryOp>
+struct map_stage_;
+
+template <typename TPredicate>
+struct filter_stage_;
+
+template <typename TOutputContainer>
+struct into_stage_;
+
+/** @brief Whether a pipeline can run over TInputContainer with
+	 TExecutionPolicy: parallel pipelines locate their blocks by index, so their
+	 input must be random access (std::execution::seq takes any input). */
+template <typename TExecutionPolicy, typename TInputContainer>
+inline constexpr bool is_pipe_input_ = ([]() constexpr->bool {
+	if constexpr (!is_parallel_policy_v<TExecutionPolicy> ||
+								!are_const_iterable_v<TInputContainer>) {
+		return false;
+	} else if constexpr (std::is_same_v<remove_everything_t<TExecutionPolicy>,
+																			std::execution::sequenced_policy>) {
+		return true;
+	} else {
+		return std::is_base_of_v<
+				std::random_access_iterator_tag,
+				typename std::iterator_traits<
+						typename TInputContainer::const_iterator>::iterator_category>;
+	}
+})();
+
+}	// namespace internal
+
+template <typename TExecutionPolicy, typename TInputContainer,
+					typename... TStages>
+class pipeline;
+
+template <typename TInputContainer,
+					std::enable_if_t<are_const_iterable_v<TInputContainer>> * = nullptr>
+pipeline<std::execution::sequenced_policy, TInputContainer> pipe(
+		const TInputContainer &input);
+
+template <typename TExecutionPolicy, typename TInputContainer,
+					std::enable_if_t<internal::is_pipe_input_<
+							TExecutionPolicy, TInputContainer>> * = nullptr>
+pipeline<remove_everything_t<TExecutionPolicy>, TInputContainer> pipe(
+		TExecutionPolicy &&policy, const TInputContainer &input);
+
+/* .--------------------------------------------------------------------------,
+	/                        ccutl::map / filter / into                        /
+ '--------------------------------------------------------------------------' */
+
+template <typename TUnaryOp>
+internal::map_stage_<TUnaryOp> map(TUnaryOp f);
+
+template <typename TPredicate>
+internal::filter_stage_<TPredicate> filter(TPredicate p);
+
+template <typename TOutputContainer,
+					std::enable_if_t<are_iterable_v<TOutputContainer>> * = nullptr>
+internal::into_stage_<TOutputContainer> into(TOutputContainer *output);
+
+}	// namespace ccutl
+
+#endif	// CPPUTILS_CCUTL_CORE_PIPELINE_H_
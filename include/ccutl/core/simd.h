@@ -0,0 +1,71 @@
+#ifndef CPPUTILS_CCUTL_CORE_SIMD_H_
+#define CPPUTILS_CCUTL_CORE_SIMD_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/core/simd.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides the element-wise operations that transform_it runs as SIMD
+ * kernels.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <cstddef>
+
+// the SIMD kernels use GCC / Clang vector extensions; other compilers (and
+// unsupported operations or containers) take the regular std::transform path
+#if defined(__GNUC__) || defined(__clang__)
+#ifndef CCUTL_HAS_SIMD
+#define CCUTL_HAS_SIMD
+#endif	// CCUTL_HAS_SIMD
+#endif
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                                ccutl::ops                                /
+ '--------------------------------------------------------------------------' */
+
+namespace ops {
+
+struct add;
+struct sub;
+struct mul;
+struct min;
+struct max;
+struct abs;
+
+template <typename T>
+struct fma;
+
+template <typename T>
+struct cast;
+
+}	// namespace ops
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::simd_width                             /
+ '--------------------------------------------------------------------------' */
+
+inline size_t simd_width();
+
+}	// namespace ccutl
+
+#endif	// CPPUTILS_CCUTL_CORE_SIMD_H_
@@ -0,0 +1,272 @@
+#ifndef CPPUTILS_CCUTL_EXECUTOR_H_
+#define CPPUTILS_CCUTL_EXECUTOR_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/executor.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides a work-stealing thread pool usable as an execution policy.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include "ccutl/core/executor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                        ccutl::work_stealing_pool                         /
+ '--------------------------------------------------------------------------' */
+
+namespace internal {
+
+/** @brief Identifies the pool worker running on the current thread (if any) so
+	 that tasks submitted from a worker go to its own deque. */
+struct pool_worker_ {
+	const work_stealing_pool *pool = nullptr;
+	size_t index = 0;
+};
+
+inline thread_local pool_worker_ this_worker_;
+
+}	// namespace internal
+
+/** @brief Fixed-size thread pool with one task deque per worker. Workers take
+	 their newest task first and, when idle, steal the oldest task of another
+	 worker. parallel_for blocks until all of its chunks are done; the calling
+	 thread runs queued tasks while there are any, so nested calls do not
+	 deadlock, and then sleeps until the last chunk finishes. */
+class work_stealing_pool {
+ public:
+	using task = std::function<void()>;
+
+	/**
+	 * @brief Starts the worker threads.
+	 *
+	 * @param n_threads Number of workers (0 uses hardware_concurrency)
+	 * @param pin_threads Whether to pin worker i to cpu i % n_cpus (Linux only)
+	 */
+	explicit work_stealing_pool(size_t n_threads = 0, bool pin_threads = false) {
+		size_t n_cpus = std::max<size_t>(1, std::thread::hardware_concurrency());
+		if (n_threads == 0) n_threads = n_cpus;
+		for (size_t i = 0; i < n_threads; ++i) {
+			queues_.push_back(std::make_unique<worker_queue>());
+		}
+		for (size_t i = 0; i < n_threads; ++i) {
+			threads_.emplace_back([this, i] { run_(i); });
+			if (pin_threads) pin_(&threads_.back(), i % n_cpus);
+		}
+	}
+
+	work_stealing_pool(const work_stealing_pool &) = delete;
+	work_stealing_pool &operator=(const work_stealing_pool &) = delete;
+
+	/** @brief Runs the remaining tasks and joins the workers. */
+	~work_stealing_pool() {
+		{
+			std::lock_guard<std::mutex> lock(sleep_mtx_);
+			stop_ = true;
+		}
+		sleep_cv_.notify_all();
+		for (auto &thread : threads_) thread.join();
+	}
+
+	size_t size() const { return queues_.size(); }
+
+	/** @brief Returns a policy tag that runs algorithms on this pool. */
+	pool_policy policy() { return pool_policy{this}; }
+
+	/** @brief Queues a task; tasks submitted from a worker of this pool go to
+		 that worker's deque, others are spread round-robin. */
+	void submit(task t) {
+		size_t i = internal::this_worker_.pool == this
+									 ? internal::this_worker_.index
+									 : next_queue_.fetch_add(1) % queues_.size();
+		{
+			// counted first (so the count never underflows) and under the sleep lock
+			// (so that a worker cannot miss the wakeup)
+			std::lock_guard<std::mutex> lock(sleep_mtx_);
+			++n_queued_;
+		}
+		{
+			std::lock_guard<std::mutex> lock(queues_[i]->mtx);
+			queues_[i]->tasks.push_back(std::move(t));
+		}
+		sleep_cv_.notify_one();
+	}
+
+	/** @brief Returns the number of chunks that parallel_for splits n_total
+		 indices into (a few per worker). */
+	size_t n_chunks(size_t n_total) const {
+		return std::min(n_total, size() * 4);
+	}
+
+	template <typename TChunkOp>
+	/** @brief Splits [0, n_total) into contiguous chunks (a few per worker),
+		 calls f(first, last) for each chunk on the pool and waits for them. The
+		 first exception thrown by f is rethrown once all chunks have finished. */
+	void parallel_for(size_t n_total, const TChunkOp &f) {
+		if (n_total == 0) return;
+		size_t n_chunks = this->n_chunks(n_total);
+		size_t chunk_sz = n_total / n_chunks;
+		size_t n_larger = n_total % n_chunks;
+
+		std::atomic<size_t> n_left{n_chunks};
+		std::exception_ptr error;
+		std::mutex done_mtx;
+		std::condition_variable done_cv;
+		for (size_t i = 0; i < n_chunks; ++i) {
+			// the first n_larger chunks take one extra index
+			size_t first = i * chunk_sz + std::min(i, n_larger);
+			size_t last = first + chunk_sz + (i < n_larger ? 1 : 0);
+			submit([&, first, last] {
+				std::exception_ptr chunk_error;
+				try {
+					f(first, last);
+				} catch (...) {
+					chunk_error = std::current_exception();
+				}
+				// under the lock, so that the caller cannot miss the wakeup or return
+				// (destroying done_cv) before it is sent
+				std::lock_guard<std::mutex> lock(done_mtx);
+				if (chunk_error && !error) error = chunk_error;
+				if (n_left.fetch_sub(1, std::memory_order_release) == 1) {
+					done_cv.notify_all();
+				}
+			});
+		}
+
+		// help out while there are queued tasks, then sleep until the chunks that
+		// are still running elsewhere are done
+		size_t self = internal::this_worker_.pool == this
+											? internal::this_worker_.index
+											: queues_.size();
+		while (n_left.load(std::memory_order_acquire) > 0) {
+			task t;
+			if (!try_pop_(self, &t)) break;
+			t();
+		}
+		std::unique_lock<std::mutex> lock(done_mtx);
+		done_cv.wait(lock, [&] { return n_left.load() == 0; });
+		if (error) std::rethrow_exception(error);
+	}
+
+ private:
+	struct worker_queue {
+		std::mutex mtx;
+		std::deque<task> tasks;
+	};
+
+	std::vector<std::unique_ptr<worker_queue>> queues_;
+	std::vector<std::thread> threads_;
+	std::atomic<size_t> next_queue_{0};
+	std::atomic<size_t> n_queued_{0};
+	std::mutex sleep_mtx_;
+	std::condition_variable sleep_cv_;
+	bool stop_ = false;
+
+	/** @brief Pops the newest task of queue self (if self is a worker index),
+		 otherwise steals the oldest task of any other queue. */
+	bool try_pop_(size_t self, task *out) {
+		if (self < queues_.size()) {
+			auto &own = *queues_[self];
+			std::lock_guard<std::mutex> lock(own.mtx);
+			if (!own.tasks.empty()) {
+				*out = std::move(own.tasks.back());
+				own.tasks.pop_back();
+				--n_queued_;
+				return true;
+			}
+		}
+		for (size_t offset = 1; offset <= queues_.size(); ++offset) {
+			auto &victim = *queues_[(self + offset) % queues_.size()];
+			std::lock_guard<std::mutex> lock(victim.mtx);
+			if (!victim.tasks.empty()) {
+				*out = std::move(victim.tasks.front());
+				victim.tasks.pop_front();
+				--n_queued_;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void run_(size_t self) {
+		internal::this_worker_ = {this, self};
+		while (true) {
+			task t;
+			if (try_pop_(self, &t)) {
+				t();
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(sleep_mtx_);
+			sleep_cv_.wait(lock, [this] { return stop_ || n_queued_ > 0; });
+			if (stop_ && n_queued_ == 0) return;
+		}
+	}
+
+	static void pin_(std::thread *thread, size_t cpu) {
+#ifdef __linux__
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(cpu, &cpus);
+		pthread_setaffinity_np(thread->native_handle(), sizeof(cpu_set_t), &cpus);
+#else
+		static_cast<void>(thread);
+		static_cast<void>(cpu);
+#endif
+	}
+};
+
+/** @brief Returns the pool used by pool_par, with one worker per hardware
+	 thread; it is started on first use. */
+inline work_stealing_pool &default_pool() {
+	static work_stealing_pool pool;
+	return pool;
+}
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::pool_policy                            /
+ '--------------------------------------------------------------------------' */
+
+inline work_stealing_pool &pool_policy::get() const {
+	return pool ? *pool : default_pool();
+}
+
+}	// namespace ccutl
+
+#endif	// CPPUTILS_CCUTL_EXECUTOR_H_
@@ -0,0 +1,209 @@
+#ifndef CPPUTILS_CCUTL_GENERATOR_H_
+#define CPPUTILS_CCUTL_GENERATOR_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/generator.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides a C++20 coroutine generator and coroutine-based enumeration.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include "ccutl/core/generator.h"
+
+#ifdef CCUTL_HAS_COROUTINES
+
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "ccutl/algorithm.h"
+#include "ccutl/type_traits.h"
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                             ccutl::generator                             /
+ '--------------------------------------------------------------------------' */
+
+template <typename T>
+/** @brief Lazily evaluated, move-only coroutine range of T. The coroutine runs
+	 until its next co_yield each time the iterator is incremented; iteration
+	 yields a const reference to the yielded value, which stays valid until the
+	 next increment (nothing is copied or buffered). Exceptions thrown by the
+	 coroutine are rethrown from begin() / operator++. */
+class generator {
+ public:
+	class promise_type {
+	 public:
+		generator get_return_object() {
+			return generator(
+					std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		std::suspend_always yield_value(const T &value) noexcept {
+			value_ = std::addressof(value);
+			return {};
+		}
+		void return_void() noexcept {}
+		void unhandled_exception() { exception_ = std::current_exception(); }
+
+		// generators only yield; co_await is not supported
+		template <typename TAwaitable>
+		std::suspend_never await_transform(TAwaitable &&) = delete;
+
+		const T &value() const { return *value_; }
+
+		void rethrow_if_failed() const {
+			if (exception_) std::rethrow_exception(exception_);
+		}
+
+	 private:
+		// the value most recently yielded by the coroutine
+		const T *value_ = nullptr;
+		// the exception that ended the coroutine, if any
+		std::exception_ptr exception_;
+	};
+
+	using handle_type = std::coroutine_handle<promise_type>;
+
+	/** @brief Input iterator that resumes the coroutine on increment. */
+	class iterator {
+	 public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T *;
+		using reference = const T &;
+
+		iterator() = default;
+		explicit iterator(handle_type handle) : handle_(handle) {}
+
+		reference operator*() const { return handle_.promise().value(); }
+		pointer operator->() const { return std::addressof(**this); }
+
+		iterator &operator++() {
+			handle_.resume();
+			handle_.promise().rethrow_if_failed();
+			return *this;
+		}
+		void operator++(int) { ++*this; }
+
+		bool operator==(std::default_sentinel_t) const {
+			return !handle_ || handle_.done();
+		}
+
+	 private:
+		handle_type handle_;
+	};
+
+	generator(const generator &) = delete;
+	generator &operator=(const generator &) = delete;
+	generator(generator &&other) noexcept
+			: handle_(std::exchange(other.handle_, nullptr)) {}
+	generator &operator=(generator &&other) noexcept {
+		if (this != &other) {
+			if (handle_) handle_.destroy();
+			handle_ = std::exchange(other.handle_, nullptr);
+		}
+		return *this;
+	}
+	~generator() {
+		if (handle_) handle_.destroy();
+	}
+
+	/** @brief Runs the coroutine to its first co_yield. May only be called
+		 once. */
+	iterator begin() {
+		if (handle_) {
+			handle_.resume();
+			handle_.promise().rethrow_if_failed();
+		}
+		return iterator(handle_);
+	}
+	std::default_sentinel_t end() const { return {}; }
+
+ private:
+	explicit generator(handle_type handle) : handle_(handle) {}
+
+	handle_type handle_;
+};
+
+/* .--------------------------------------------------------------------------,
+	/                    ccutl::co_combinate / co_permutate                    /
+ '--------------------------------------------------------------------------' */
+
+namespace internal {
+
+template <typename T, typename TRange>
+/** @brief Yields each sample of an enumeration range as a T. A single T is
+	 refilled for every sample, so its storage is reused across yields. */
+generator<T> co_samples_(TRange range) {
+	T subresult;
+	for (const auto &sample : range) {
+		subresult.clear();
+		std::copy(sample.begin(), sample.end(),
+							std::back_insert_iterator(subresult));
+		co_yield subresult;
+	}
+}
+
+}	// namespace internal
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Returns a coroutine generator over all combinations of the values in
+ * a container T, in the same order as combinate. Each combination is yielded
+ * as a const T & that is refilled in place for the next one.
+ *
+ * @param target Target container (must outlive the generator)
+ * @param sample_sz Sample size
+ * @return generator<T>
+ */
+generator<T> co_combinate(const T &target, size_t sample_sz) {
+	return internal::co_samples_<T>(lazy_combinate(target, sample_sz));
+}
+
+template <typename T, std::enable_if_t<are_const_iterable_v<T>> *>
+/**
+ * @brief Returns a coroutine generator over all permutations of the values in
+ * a container T, in the same order as permutate. With repetition this is the
+ * counting mode (the first position moves fastest).
+ *
+ * @param target Target container (must outlive the generator)
+ * @param sample_sz Sample size to pick from (sz of 0 uses target.size())
+ * @param repetition Whether or not to allow repetition (aaa, aab, etc.)
+ * @return generator<T>
+ */
+generator<T> co_permutate(const T &target, size_t sample_sz, bool repetition) {
+	return internal::co_samples_<T>(
+			lazy_permutate(target, sample_sz, repetition));
+}
+
+}	// namespace ccutl
+
+#endif	// CCUTL_HAS_COROUTINES
+
+#endif	// CPPUTILS_CCUTL_GENERATOR_H_
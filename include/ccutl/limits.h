@@ -22,13 +22,14 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-05-09
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
 #include "ccutl/core/limits.h"
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 #include <vector>
@@ -509,6 +510,44 @@ bool is_sub_overflow(TA a, TB b) {
 	}
 }
 
+template <typename TLim, typename TA, typename TB,
+					std::enable_if_t<are_arithmetic_v<TLim, TA, TB>>*>
+/** @brief Checks if a and b cannot be multiplied without breaking the limits
+	 of TLim. */
+constexpr bool is_mul_overflow(TA a, TB b) {
+	if constexpr (are_floating_point_v<TLim> || are_floating_point_v<TA> ||
+								are_floating_point_v<TB>) {
+		// compare the widest floating point product against the limits
+		long double product =
+				static_cast<long double>(a) * static_cast<long double>(b);
+		return product > static_cast<long double>(max_v<TLim>) ||
+					 product < static_cast<long double>(min_v<TLim>);
+	} else {
+		using UMax = std::uintmax_t;
+		if (a == 0 || b == 0) return false;	// min <= 0 <= max
+
+		// compare magnitudes: |a| * |b| > |limit| <=> |a| > |limit| / |b|
+		bool neg_a = false;
+		bool neg_b = false;
+		if constexpr (are_signed_v<TA>) neg_a = a < 0;
+		if constexpr (are_signed_v<TB>) neg_b = b < 0;
+		UMax mag_a = neg_a ? UMax{0} - static_cast<UMax>(a) : static_cast<UMax>(a);
+		UMax mag_b = neg_b ? UMax{0} - static_cast<UMax>(b) : static_cast<UMax>(b);
+
+		UMax mag_lim = static_cast<UMax>(max_v<TLim>);
+		if (neg_a != neg_b) {
+			/*                        a * b < 0                        */
+			if constexpr (are_unsigned_v<TLim>) {
+				return true;	// min == 0
+			} else {
+				// -min == max + 1
+				++mag_lim;
+			}
+		}
+		return mag_a > mag_lim / mag_b;
+	}
+}
+
 }	// namespace ccutl
 
 #endif	// CPPUTILS_CCUTL_LIMITS_H_
@@ -22,12 +22,13 @@
  * @version 0.1.0
  * @since cpputils 0.5.0
  * @date created 2019-07-09
- * @date modified 2019-07-12
+ * @date modified 2026-10-17
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
 #include "ccutl/core/math.h"
 
+#include <cstdint>
 #include <type_traits>
 
 #include "ccutl/compare.h"
@@ -213,6 +214,46 @@ void safe_add(TOutput* a, TAddend b) {
 	*a = safe_add<std::remove_pointer_t<TOutput>>(*a, b);
 }
 
+template <typename TResult, typename TA, typename TB,
+					std::enable_if_t<are_arithmetic_v<TResult, TA, TB>>*>
+/** @brief Checks if a and b cannot be multiplied without breaking the limits
+	 of TResult. If not, returns the product. If so, throws const char *
+	 "EOverflow". */
+constexpr TResult safe_mul(TA a, TB b) {
+	if (is_mul_overflow<TResult>(a, b)) throw "EOverflow";
+	if constexpr (are_floating_point_v<TResult, TA, TB>) {
+		return static_cast<TResult>(a) * static_cast<TResult>(b);
+	} else if constexpr (are_floating_point_v<TResult> ||
+											 are_floating_point_v<TA> ||
+											 are_floating_point_v<TB>) {
+		// the product fits in TResult, but the operands may not
+		return static_cast<TResult>(static_cast<long double>(a) *
+																static_cast<long double>(b));
+	} else {
+		// the product fits in TResult, but the operands may not, and a signed
+		// intermediate could overflow; multiply the magnitudes unsigned (never
+		// promoted to int) and apply the sign afterwards
+		using UMax = std::uintmax_t;
+		bool neg_a = false;
+		bool neg_b = false;
+		if constexpr (are_signed_v<TA>) neg_a = a < 0;
+		if constexpr (are_signed_v<TB>) neg_b = b < 0;
+		UMax mag_a = neg_a ? UMax{0} - static_cast<UMax>(a) : static_cast<UMax>(a);
+		UMax mag_b = neg_b ? UMax{0} - static_cast<UMax>(b) : static_cast<UMax>(b);
+		UMax mag = mag_a * mag_b;
+		return static_cast<TResult>(neg_a != neg_b ? UMax{0} - mag : mag);
+	}
+}
+
+template <typename TOutput, typename TMultiplier,
+					std::enable_if_t<are_arithmetic_v<remove_everything_t<TOutput>,
+																						TMultiplier>>*>
+/** @brief Multiplies the value of a by b and updates a's value. Throws
+	 "EOverflow" if multiplication would result in an overflow. */
+constexpr void safe_mul(TOutput* a, TMultiplier b) {
+	*a = safe_mul<std::remove_pointer_t<TOutput>>(*a, b);
+}
+
 }	// namespace ccutl
 
 #endif	// CPPUTILS_CCUTL_MATH_H_
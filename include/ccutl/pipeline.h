@@ -0,0 +1,310 @@
+#ifndef CPPUTILS_CCUTL_PIPELINE_H_
+#define CPPUTILS_CCUTL_PIPELINE_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/pipeline.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides lazy transform pipelines that fuse their stages into a single
+ * pass.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include "ccutl/core/pipeline.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ccutl/algorithm.h"
+#include "ccutl/executor.h"
+#include "ccutl/type_traits.h"
+
+namespace ccutl {
+
+/* .--------------------------------------------------------------------------,
+	/                             ccutl::pipeline                              /
+ '--------------------------------------------------------------------------' */
+
+namespace internal {
+
+template <typename TUnaryOp>
+/** @brief Replaces each value v with f(v). */
+struct map_stage_ {
+	TUnaryOp f;
+
+	template <typename T>
+	using output_t = std::decay_t<std::invoke_result_t<const TUnaryOp &, T>>;
+};
+
+template <typename TPredicate>
+/** @brief Drops each value v for which p(v) is false. */
+struct filter_stage_ {
+	TPredicate p;
+
+	template <typename T>
+	using output_t = std::decay_t<T>;
+};
+
+template <typename TOutputContainer>
+/** @brief Runs a pipeline, appending its values to output. */
+struct into_stage_ {
+	TOutputContainer *output;
+};
+
+template <typename TStage>
+inline constexpr bool is_filter_stage_ = false;
+
+template <typename TPredicate>
+inline constexpr bool is_filter_stage_<filter_stage_<TPredicate>> = true;
+
+/** @brief Type of the values that leave the last of TStages, given values of
+	 type T entering the first. */
+template <typename T, typename... TStages>
+struct pipeline_value_ {
+	using type = T;
+};
+
+template <typename T, typename TStage, typename... TStages>
+struct pipeline_value_<T, TStage, TStages...> {
+	using type = typename pipeline_value_<
+			typename TStage::template output_t<const T &>, TStages...>::type;
+};
+
+}	// namespace internal
+
+template <typename TExecutionPolicy, typename TInputContainer,
+					typename... TStages>
+/**
+ * @brief Lazy chain of map / filter stages over an input container, built with
+ * pipe(input) | map(f) | filter(p) | ... and run by | into(&output). Each input
+ * value passes through every stage before the next one is read, so no
+ * intermediate containers are created. With a parallel policy the input is
+ * split into contiguous blocks; results keep the input order either way.
+ *
+ * The pipeline refers to the input (it is not copied), so it should be run in
+ * the same full expression as pipe() unless the input outlives it.
+ */
+class pipeline {
+ public:
+	/** @brief Type of the values appended to the output. */
+	using value_type =
+			typename internal::pipeline_value_<typename TInputContainer::value_type,
+																				 TStages...>::type;
+
+	pipeline(TExecutionPolicy policy, const TInputContainer *input,
+					 std::tuple<TStages...> stages)
+			: policy_(std::move(policy)), input_(input), stages_(std::move(stages)) {}
+
+	template <typename TUnaryOp>
+	pipeline<TExecutionPolicy, TInputContainer, TStages...,
+					 internal::map_stage_<TUnaryOp>>
+	operator|(internal::map_stage_<TUnaryOp> stage) const {
+		return {policy_, input_,
+						std::tuple_cat(stages_, std::make_tuple(std::move(stage)))};
+	}
+
+	template <typename TPredicate>
+	pipeline<TExecutionPolicy, TInputContainer, TStages...,
+					 internal::filter_stage_<TPredicate>>
+	operator|(internal::filter_stage_<TPredicate> stage) const {
+		return {policy_, input_,
+						std::tuple_cat(stages_, std::make_tuple(std::move(stage)))};
+	}
+
+	template <typename TOutputContainer>
+	/** @brief Runs the pipeline, appending its values to the output; returns the
+		 number of values appended. */
+	size_t operator|(internal::into_stage_<TOutputContainer> sink) const {
+		if constexpr (std::is_same_v<TExecutionPolicy,
+																 std::execution::sequenced_policy>) {
+			return run_serial_(sink.output);
+		} else if constexpr ((internal::is_filter_stage_<TStages> || ...) ||
+												 !internal::has_random_access_<TOutputContainer>) {
+			return run_blocks_(sink.output);
+		} else {
+			return run_slots_(sink.output);
+		}
+	}
+
+ private:
+	TExecutionPolicy policy_;
+	const TInputContainer *input_;
+	std::tuple<TStages...> stages_;
+
+	template <size_t I = 0, typename T, typename TSink>
+	/** @brief Passes a value through stages I... and hands the result (if it
+		 was not filtered out) to sink. */
+	void apply_(T &&value, const TSink &sink) const {
+		if constexpr (I == sizeof...(TStages)) {
+			sink(std::forward<T>(value));
+		} else {
+			const auto &stage = std::get<I>(stages_);
+			if constexpr (internal::is_filter_stage_<
+												std::tuple_element_t<I, std::tuple<TStages...>>>) {
+				if (stage.p(value)) apply_<I + 1>(std::forward<T>(value), sink);
+			} else {
+				apply_<I + 1>(stage.f(std::forward<T>(value)), sink);
+			}
+		}
+	}
+
+	template <typename TOutputContainer>
+	size_t run_serial_(TOutputContainer *output) const {
+		size_t n_appended = 0;
+		for (const auto &value : *input_) {
+			apply_(value, [&](auto &&result) {
+				output->push_back(std::forward<decltype(result)>(result));
+				++n_appended;
+			});
+		}
+		return n_appended;
+	}
+
+	template <typename TOutputContainer>
+	/** @brief Without filters every input value yields one output value, so the
+		 output is grown once and the chunks write their slots in place. */
+	size_t run_slots_(TOutputContainer *output) const {
+		size_t n = internal::n_elements_(*input_);
+		size_t offset = output->size();
+		output->resize(offset + n);
+		internal::for_each_chunk_(policy_, n, [&](size_t first, size_t last) {
+			auto in = std::next(input_->cbegin(), static_cast<std::ptrdiff_t>(first));
+			auto out =
+					std::next(output->begin(), static_cast<std::ptrdiff_t>(offset + first));
+			for (size_t i = first; i < last; ++i, ++in, ++out) {
+				apply_(*in, [&](auto &&result) {
+					*out = std::forward<decltype(result)>(result);
+				});
+			}
+		});
+		return n;
+	}
+
+	/** @brief Maximum number of input values per block of run_blocks_. */
+	static constexpr size_t max_block_sz_ = 16384;
+
+	template <typename TOutputContainer>
+	/** @brief With filters the number of values per block is not known in
+		 advance, so each block collects its values in its own buffer and the
+		 buffers are appended in order. The input is taken in rounds of one block
+		 per for_each_chunk_ chunk, with at most max_block_sz_ values per block,
+		 so the buffers never hold more than one round; their capacity is reused
+		 from round to round. */
+	size_t run_blocks_(TOutputContainer *output) const {
+		size_t n = internal::n_elements_(*input_);
+		size_t round_sz = internal::n_chunks_(policy_, n) * max_block_sz_;
+		std::vector<std::vector<value_type>> buffers;
+		size_t n_appended = 0;
+		for (size_t round_first = 0; round_first < n; round_first += round_sz) {
+			size_t round_n = std::min(round_sz, n - round_first);
+			size_t n_blocks = internal::n_chunks_(policy_, round_n);
+			size_t block_sz = round_n / n_blocks;
+			size_t n_larger = round_n % n_blocks;
+			if (buffers.size() < n_blocks) buffers.resize(n_blocks);
+			internal::for_each_chunk_(
+					policy_, n_blocks, [&](size_t first_block, size_t last_block) {
+						for (size_t b = first_block; b < last_block; ++b) {
+							// the first n_larger blocks take one extra value
+							size_t first = round_first + b * block_sz + std::min(b, n_larger);
+							size_t last = first + block_sz + (b < n_larger ? 1 : 0);
+							auto in =
+									std::next(input_->cbegin(), static_cast<std::ptrdiff_t>(first));
+							for (size_t i = first; i < last; ++i, ++in) {
+								apply_(*in, [&](auto &&result) {
+									buffers[b].push_back(std::forward<decltype(result)>(result));
+								});
+							}
+						}
+					});
+			for (size_t b = 0; b < n_blocks; ++b) {
+				auto &buffer = buffers[b];
+				output->insert(output->end(), std::make_move_iterator(buffer.begin()),
+											 std::make_move_iterator(buffer.end()));
+				n_appended += buffer.size();
+				buffer.clear();
+			}
+		}
+		return n_appended;
+	}
+};
+
+template <typename TInputContainer,
+					std::enable_if_t<are_const_iterable_v<TInputContainer>> *>
+/**
+ * @brief Starts a sequential pipeline over a container.
+ *
+ * @param input Input container (referenced, not copied)
+ * @return pipeline<std::execution::sequenced_policy, TInputContainer>
+ */
+pipeline<std::execution::sequenced_policy, TInputContainer> pipe(
+		const TInputContainer &input) {
+	return {std::execution::seq, &input, {}};
+}
+
+template <typename TExecutionPolicy, typename TInputContainer,
+					std::enable_if_t<
+							internal::is_pipe_input_<TExecutionPolicy, TInputContainer>> *>
+/**
+ * @brief Starts a pipeline over a container that runs with an execution policy
+ * (std::execution::seq runs serially).
+ *
+ * @param policy Standard execution policy or pool_policy
+ * @param input Input container (referenced, not copied); must be random
+ *              access unless the policy is std::execution::seq
+ * @return pipeline<remove_everything_t<TExecutionPolicy>, TInputContainer>
+ */
+pipeline<remove_everything_t<TExecutionPolicy>, TInputContainer> pipe(
+		TExecutionPolicy &&policy, const TInputContainer &input) {
+	return {policy, &input, {}};
+}
+
+/* .--------------------------------------------------------------------------,
+	/                        ccutl::map / filter / into                        /
+ '--------------------------------------------------------------------------' */
+
+template <typename TUnaryOp>
+/** @brief Pipeline stage that replaces each value v with f(v). */
+internal::map_stage_<TUnaryOp> map(TUnaryOp f) {
+	return {std::move(f)};
+}
+
+template <typename TPredicate>
+/** @brief Pipeline stage that keeps the values v for which p(v) is true. */
+internal::filter_stage_<TPredicate> filter(TPredicate p) {
+	return {std::move(p)};
+}
+
+template <typename TOutputContainer,
+					std::enable_if_t<are_iterable_v<TOutputContainer>> *>
+/** @brief Pipeline sink that runs the pipeline and appends its values to
+	 output. */
+internal::into_stage_<TOutputContainer> into(TOutputContainer *output) {
+	return {output};
+}
+
+}	// namespace ccutl
+
+#endif	// CPPUTILS_CCUTL_PIPELINE_H_
@@ -0,0 +1,451 @@
+#ifndef CPPUTILS_CCUTL_SIMD_H_
+#define CPPUTILS_CCUTL_SIMD_H_
+
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ccutl/simd.h
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Provides the element-wise operations that transform_it runs as SIMD
+ * kernels.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include "ccutl/core/simd.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ccutl {
+
+namespace internal {
+
+template <typename T, bool = std::is_integral_v<T> && !std::is_same_v<T, bool>>
+/** @brief Type that ops:: compute T in. */
+struct op_wrap_ {
+	using type = T;
+};
+
+template <typename T>
+/** @brief Integers compute modulo 2^N in an unsigned type at least as wide as
+	 unsigned int, as signed overflow (and the promotion of unsigned short to
+	 int) is undefined; the cast back yields the truncated result. */
+struct op_wrap_<T, true> {
+	using type = std::common_type_t<unsigned, std::make_unsigned_t<T>>;
+};
+
+template <typename T>
+using op_wrap_t_ = typename op_wrap_<T>::type;
+
+}	// namespace internal
+
+/* .--------------------------------------------------------------------------,
+	/                                ccutl::ops                                /
+ '--------------------------------------------------------------------------' */
+
+// Element-wise operations that transform_it recognizes and runs as SIMD kernels
+// (see simd_transformable_); results are cast back to the operand type (no
+// integer promotion), as the vector lanes are
+
+namespace ops {
+
+/** @brief a + b */
+struct add {
+	template <typename T>
+	constexpr T operator()(const T &a, const T &b) const {
+		using W = internal::op_wrap_t_<T>;
+		return static_cast<T>(static_cast<W>(a) + static_cast<W>(b));
+	}
+};
+
+/** @brief a - b */
+struct sub {
+	template <typename T>
+	constexpr T operator()(const T &a, const T &b) const {
+		using W = internal::op_wrap_t_<T>;
+		return static_cast<T>(static_cast<W>(a) - static_cast<W>(b));
+	}
+};
+
+/** @brief a * b */
+struct mul {
+	template <typename T>
+	constexpr T operator()(const T &a, const T &b) const {
+		using W = internal::op_wrap_t_<T>;
+		return static_cast<T>(static_cast<W>(a) * static_cast<W>(b));
+	}
+};
+
+/** @brief b < a ? b : a (same as std::min) */
+struct min {
+	template <typename T>
+	constexpr T operator()(const T &a, const T &b) const {
+		return b < a ? b : a;
+	}
+};
+
+/** @brief a < b ? b : a (same as std::max) */
+struct max {
+	template <typename T>
+	constexpr T operator()(const T &a, const T &b) const {
+		return a < b ? b : a;
+	}
+};
+
+/** @brief a < 0 ? -a : a (-0.0 is kept as is) */
+struct abs {
+	template <typename T>
+	constexpr T operator()(const T &a) const {
+		if constexpr (std::is_unsigned_v<T>) {
+			return a;
+		} else {
+			using W = internal::op_wrap_t_<T>;
+			return a < T{} ? static_cast<T>(-static_cast<W>(a)) : a;
+		}
+	}
+};
+
+template <typename T>
+/** @brief a * mul + add. Floating-point values are rounded once (std::fma) on
+	 every path (vector body, scalar tail, fallbacks), so results do not depend
+	 on the input length, alignment or policy. CPUs without FMA units make that
+	 a library call per value. */
+struct fma {
+	T mul;
+	T add;
+
+	template <typename V>
+	constexpr V operator()(const V &a) const {
+		if constexpr (std::is_floating_point_v<V>) {
+			return static_cast<V>(std::fma(a, mul, add));
+		} else {
+			using W = internal::op_wrap_t_<V>;
+			return static_cast<V>(static_cast<W>(a) * static_cast<W>(mul) +
+														static_cast<W>(add));
+		}
+	}
+};
+
+template <typename T>
+/** @brief static_cast<T>(a) */
+struct cast {
+	template <typename V>
+	constexpr T operator()(const V &a) const {
+		return static_cast<T>(a);
+	}
+};
+
+}	// namespace ops
+
+/* .--------------------------------------------------------------------------,
+	/                            ccutl::simd_width                             /
+ '--------------------------------------------------------------------------' */
+
+/** @brief Returns the vector width in bytes (64 for AVX-512, 32 for AVX2, 16
+	 otherwise) of the kernels that transform_it dispatches to on this CPU. The
+	 CPU is queried once. */
+inline size_t simd_width() {
+#if defined(CCUTL_HAS_SIMD) && (defined(__x86_64__) || defined(__i386__))
+	static const size_t width = []() -> size_t {
+		if (__builtin_cpu_supports("avx512f") &&
+				__builtin_cpu_supports("avx512bw") &&
+				__builtin_cpu_supports("avx512dq")) {
+			return 64;
+		}
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+			return 32;
+		}
+		return 16;
+	}();
+	return width;
+#else
+	return 16;
+#endif
+}
+
+namespace internal {
+
+/** @brief Whether T can be a SIMD vector lane. */
+template <typename T>
+inline constexpr bool is_simd_value_ =
+		std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+		!std::is_same_v<T, long double>;
+
+/** @brief Whether T exposes its values contiguously through data(). */
+template <typename T, typename = void>
+inline constexpr bool is_contiguous_ = false;
+
+template <typename T>
+inline constexpr bool is_contiguous_<
+		T, std::enable_if_t<std::is_same_v<
+					 decltype(std::declval<const T &>().data()),
+					 const typename T::value_type *>>> = true;
+
+/** @brief Maps the std functors of the known operations to their ccutl::ops
+	 counterparts; type is void for anything else. operand is the operand type
+	 that a std functor is fixed to (void if it is generic). */
+template <typename TOp>
+struct simd_op_ {
+	using type = void;
+	using operand = void;
+};
+
+template <typename TOp>
+using simd_op_t_ = typename simd_op_<TOp>::type;
+
+#define CCUTL_SIMD_STD_OP_(from, to) \
+	template <typename T>              \
+	struct simd_op_<from<T>> {         \
+		using type = to;                 \
+		using operand = T;               \
+	};
+
+CCUTL_SIMD_STD_OP_(std::plus, ops::add)
+CCUTL_SIMD_STD_OP_(std::minus, ops::sub)
+CCUTL_SIMD_STD_OP_(std::multiplies, ops::mul)
+
+#undef CCUTL_SIMD_STD_OP_
+
+#define CCUTL_SIMD_OP_(op)  \
+	template <>               \
+	struct simd_op_<op> {     \
+		using type = op;        \
+		using operand = void;   \
+	};
+
+CCUTL_SIMD_OP_(ops::add)
+CCUTL_SIMD_OP_(ops::sub)
+CCUTL_SIMD_OP_(ops::mul)
+CCUTL_SIMD_OP_(ops::min)
+CCUTL_SIMD_OP_(ops::max)
+CCUTL_SIMD_OP_(ops::abs)
+
+#undef CCUTL_SIMD_OP_
+
+template <typename T>
+struct simd_op_<ops::fma<T>> {
+	using type = ops::fma<T>;
+	using operand = void;
+};
+
+template <typename T>
+struct simd_op_<ops::cast<T>> {
+	using type = ops::cast<T>;
+	using operand = void;
+};
+
+template <typename TOp>
+inline constexpr bool is_simd_cast_ = false;
+
+template <typename T>
+inline constexpr bool is_simd_cast_<ops::cast<T>> = true;
+
+/**
+ * @brief Whether transforming the values of TInputs into TOutput with TOp can
+ * use the SIMD kernels: the operation must be one of ccutl::ops (or
+ * std::plus / minus / multiplies) taking as many operands as there are inputs,
+ * and every value type must be a SIMD lane type equal to the output type
+ * (ops::cast<TOutput> may convert from any lane type).
+ */
+template <typename TOp, typename TOutput, typename... TInputs>
+inline constexpr bool simd_transformable_ = ([]() constexpr->bool {
+	using Op = simd_op_t_<TOp>;
+	using Operand = typename simd_op_<TOp>::operand;
+#ifndef CCUTL_HAS_SIMD
+	return false;
+#else
+	if constexpr (std::is_void_v<Op> ||
+								!(is_simd_value_<TOutput> && ... && is_simd_value_<TInputs>) ||
+								!(std::is_void_v<Operand> || std::is_same_v<Operand, TOutput>)) {
+		return false;
+	} else if constexpr (is_simd_cast_<Op>) {
+		return sizeof...(TInputs) == 1 &&
+					 std::is_same_v<Op, ops::cast<TOutput>>;
+	} else if constexpr (sizeof...(TInputs) == 1) {
+		return (std::is_same_v<TOutput, TInputs> && ...) &&
+					 (std::is_same_v<Op, ops::abs> || std::is_same_v<Op, ops::fma<TOutput>>);
+	} else {
+		return sizeof...(TInputs) == 2 && (std::is_same_v<TOutput, TInputs> && ...) &&
+					 std::is_invocable_v<Op, const TOutput &, const TOutput &>;
+	}
+#endif
+})();
+
+template <typename TOp>
+/** @brief Converts a known operation to its ccutl::ops form. */
+constexpr simd_op_t_<TOp> as_simd_op_(const TOp &f) {
+	if constexpr (std::is_same_v<simd_op_t_<TOp>, TOp>) {
+		return f;
+	} else {
+		return {};
+	}
+}
+
+#ifdef CCUTL_HAS_SIMD
+
+#define CCUTL_SIMD_INLINE_ inline __attribute__((always_inline))
+
+template <typename T, size_t N>
+/** @brief GCC / Clang vector of N values of T. */
+struct simd_vec_ {
+	typedef T type __attribute__((vector_size(sizeof(T) * N)));
+};
+
+template <typename T>
+/** @brief Lane type that vector arithmetic on T runs in: signed integer lanes
+	 wrap in their unsigned counterpart, as signed vector overflow is undefined
+	 (the bits match the truncated scalar result). */
+using simd_wrap_t_ = typename std::conditional_t<
+		std::is_integral_v<T> && std::is_signed_v<T>, std::make_unsigned<T>,
+		std::common_type<T>>::type;
+
+template <size_t N, typename TOp, typename TOutput, typename TInput>
+/** @brief Applies a unary op to one vector of N values. Vectors are only
+	 passed by reference so that no function returns a vector type (which would
+	 change the calling convention under the target-specific kernels). */
+CCUTL_SIMD_INLINE_ void simd_step_(const TOp &op, TOutput *out,
+																	 const TInput *in) {
+	using InVec = typename simd_vec_<TInput, N>::type;
+	using OutVec = typename simd_vec_<TOutput, N>::type;
+	using Wrap = simd_wrap_t_<TInput>;
+	using WrapVec = typename simd_vec_<Wrap, N>::type;
+	InVec a;
+	std::memcpy(&a, in, sizeof(a));
+	OutVec result;
+	if constexpr (is_simd_cast_<TOp>) {
+		result = __builtin_convertvector(a, OutVec);
+	} else if constexpr (std::is_same_v<TOp, ops::abs>) {
+		if constexpr (std::is_unsigned_v<TInput>) {
+			result = a;
+		} else {
+			WrapVec neg = -__builtin_convertvector(a, WrapVec);
+			result = a < InVec{} ? __builtin_convertvector(neg, InVec) : a;
+		}
+	} else if constexpr (std::is_floating_point_v<TInput>) {
+		// one rounding per lane, as in ops::fma (packed vfmadd under the FMA
+		// targets); a * mul + add could be contracted here but not in the tail
+		for (size_t lane = 0; lane < N; ++lane) {
+			result[lane] = std::fma(a[lane], op.mul, op.add);
+		}
+	} else {
+		WrapVec wrapped = __builtin_convertvector(a, WrapVec) *
+													static_cast<Wrap>(op.mul) +
+											static_cast<Wrap>(op.add);
+		result = __builtin_convertvector(wrapped, OutVec);
+	}
+	std::memcpy(out, &result, sizeof(result));
+}
+
+template <size_t N, typename TOp, typename TOutput, typename TInput>
+/** @brief Applies a binary op to one vector of N values. */
+CCUTL_SIMD_INLINE_ void simd_step_(const TOp &, TOutput *out,
+																	 const TInput *in1, const TInput *in2) {
+	constexpr bool is_arithmetic = std::is_same_v<TOp, ops::add> ||
+																 std::is_same_v<TOp, ops::sub> ||
+																 std::is_same_v<TOp, ops::mul>;
+	// min / max compare with the lane's own signedness
+	using Vec = typename simd_vec_<
+			std::conditional_t<is_arithmetic, simd_wrap_t_<TInput>, TInput>,
+			N>::type;
+	Vec a;
+	Vec b;
+	std::memcpy(&a, in1, sizeof(a));
+	std::memcpy(&b, in2, sizeof(b));
+	Vec result;
+	if constexpr (std::is_same_v<TOp, ops::add>) {
+		result = a + b;
+	} else if constexpr (std::is_same_v<TOp, ops::sub>) {
+		result = a - b;
+	} else if constexpr (std::is_same_v<TOp, ops::mul>) {
+		result = a * b;
+	} else if constexpr (std::is_same_v<TOp, ops::min>) {
+		result = b < a ? b : a;
+	} else {
+		result = a < b ? b : a;
+	}
+	std::memcpy(out, &result, sizeof(result));
+}
+
+template <size_t VecBytes, typename TOp, typename TOutput, typename... TInputs>
+/** @brief Applies op to n elements, one vector of VecBytes (of the first input
+	 type) at a time, then to the remaining tail one element at a time. The
+	 output may alias an input. */
+CCUTL_SIMD_INLINE_ void simd_loop_(size_t n, const TOp &op, TOutput *out,
+																	 const TInputs *... in) {
+	constexpr size_t n_lanes =
+			VecBytes / sizeof(std::tuple_element_t<0, std::tuple<TInputs...>>);
+	size_t i = 0;
+	for (; i + n_lanes <= n; i += n_lanes) {
+		simd_step_<n_lanes>(op, out + i, (in + i)...);
+	}
+	for (; i < n; ++i) out[i] = op(in[i]...);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+template <typename TOp, typename TOutput, typename... TInputs>
+__attribute__((target("avx512f,avx512bw,avx512dq"))) void simd_loop_avx512_(
+		size_t n, const TOp &op, TOutput *out, const TInputs *... in) {
+	simd_loop_<64>(n, op, out, in...);
+}
+
+template <typename TOp, typename TOutput, typename... TInputs>
+__attribute__((target("avx2,fma"))) void simd_loop_avx2_(
+		size_t n, const TOp &op, TOutput *out, const TInputs *... in) {
+	simd_loop_<32>(n, op, out, in...);
+}
+
+#endif
+
+#undef CCUTL_SIMD_INLINE_
+
+#endif	// CCUTL_HAS_SIMD
+
+template <typename TOp, typename TOutput, typename... TInputs>
+/** @brief Applies op to n elements of the inputs using the kernel of the
+	 widest vector unit reported by simd_width. */
+void simd_transform_(size_t n, const TOp &op, TOutput *out,
+										 const TInputs *... in) {
+#ifdef CCUTL_HAS_SIMD
+#if defined(__x86_64__) || defined(__i386__)
+	switch (simd_width()) {
+		case 64:
+			return simd_loop_avx512_(n, op, out, in...);
+		case 32:
+			return simd_loop_avx2_(n, op, out, in...);
+		default:
+			break;
+	}
+#endif
+	simd_loop_<16>(n, op, out, in...);
+#else
+	for (size_t i = 0; i < n; ++i) out[i] = op(in[i]...);
+#endif
+}
+
+}	// namespace internal
+
+}	// namespace ccutl
+
+#endif	// CPPUTILS_CCUTL_SIMD_H_
@@ -0,0 +1,798 @@
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file test/algorithm.cc
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Tests the functions of ccutl/algorithm.h.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <execution>
+#include <forward_list>
+#include <limits>
+#include <list>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ccutl_test.h"
+
+#include "ccutl/algorithm.h"
+
+namespace ccutl_tests {
+
+namespace algorithm {
+template <typename T, typename = void>
+inline constexpr bool can_revolve = false;
+
+template <typename T>
+inline constexpr bool can_revolve<
+		T, std::void_t<decltype(ccutl::revolving_door_combinate(
+					 std::declval<const T &>(), 1))>> = true;
+}	// namespace algorithm
+
+CCUTL_TEST(algorithm_transform_it, back_insert) {
+	std::vector<int> input(10000);
+	std::iota(input.begin(), input.end(), 0);
+	// should append to the existing output with or without a policy
+	std::vector<long> serial{-1};
+	ccutl::transform_it<true>(input, &serial,
+														[](int v) { return static_cast<long>(v) * 2; });
+	std::vector<long> parallel{-1};
+	auto end = ccutl::transform_it<true>(
+			std::execution::par, input, &parallel,
+			[](int v) { return static_cast<long>(v) * 2; });
+	EXPECT_EQ(end, parallel.end());
+	EXPECT_EQ(parallel, serial);
+	EXPECT_EQ(parallel.size(), 10001U);
+	// should do the same for binary operations
+	std::vector<int> sums;
+	ccutl::transform_it<true>(std::execution::par_unseq, input, input, &sums,
+														[](int a, int b) { return a + b; });
+	EXPECT_EQ(sums.size(), input.size());
+	EXPECT_EQ(sums.back(), 19998);
+	// should write in place without BackInsert
+	ccutl::transform_it(std::execution::par, input, &sums,
+											[](int v) { return -v; });
+	EXPECT_EQ(sums[3], -3);
+}
+
+CCUTL_TEST(algorithm_transform_it, zip) {
+	std::vector<double> price{1.5, 2.0, 4.0, 8.0};
+	std::list<int> qty{2, 3, 4, 5, 6};
+	std::vector<double> fee{0.25, 0.5, 0.75, 1.0};
+	auto cost = [](double p, int q, double f) { return p * q + f; };
+	// should walk the containers in lockstep up to the shortest one
+	std::vector<double> result{-1};
+	ccutl::transform_it<true>(ccutl::zip(price, qty, fee), &result, cost);
+	EXPECT_EQ(result, (std::vector<double>{-1, 3.25, 6.5, 16.75, 41}));
+	std::vector<double> in_place(4);
+	auto end = ccutl::transform_it(ccutl::zip(price, qty, fee), &in_place, cost);
+	EXPECT_EQ(end, in_place.end());
+	EXPECT_EQ(in_place, (std::vector<double>{3.25, 6.5, 16.75, 41}));
+	// should match the serial result with a policy (contiguous and not)
+	std::vector<int> a(10000);
+	std::vector<int> b(10000);
+	std::vector<int> c(10000);
+	std::iota(a.begin(), a.end(), 0);
+	std::iota(b.begin(), b.end(), 5);
+	std::iota(c.begin(), c.end(), -3);
+	auto sum3 = [](int x, int y, int z) { return x + y + z; };
+	std::vector<int> serial;
+	ccutl::transform_it<true>(ccutl::zip(a, b, c), &serial, sum3);
+	std::vector<int> parallel;
+	ccutl::transform_it<true>(std::execution::par, ccutl::zip(a, b, c),
+														&parallel, sum3);
+	EXPECT_EQ(parallel, serial);
+	std::list<int> listed(c.begin(), c.end());
+	std::vector<int> pooled(a.size());
+	ccutl::transform_it(ccutl::pool_par, ccutl::zip(a, b, listed), &pooled,
+											sum3);
+	EXPECT_EQ(pooled, serial);
+	// should use the known operations with two inputs
+	std::vector<int> sums;
+	ccutl::transform_it<true>(ccutl::zip(a, b), &sums, ccutl::ops::add{});
+	EXPECT_EQ(sums[9999], 9999 + 10004);
+}
+
+CCUTL_TEST(algorithm_iterate_it, zip) {
+	std::vector<int> a{1, 2, 3};
+	std::list<char> b{'a', 'b', 'c', 'd'};
+	std::string c = "xyz";
+	// should pass every iterator in lockstep
+	std::vector<std::string> visited;
+	ccutl::iterate_it(ccutl::zip(a, b, c), [&](auto it1, auto it2, auto it3) {
+		visited.push_back(std::to_string(*it1) + *it2 + *it3);
+	});
+	EXPECT_EQ(visited, (std::vector<std::string>{"1ax", "2by", "3cz"}));
+	visited.clear();
+	ccutl::iterate_it<true>(ccutl::zip(a, c), [&](auto it1, auto it2) {
+		visited.push_back(std::to_string(*it1) + *it2);
+	});
+	EXPECT_EQ(visited, (std::vector<std::string>{"3z", "2y", "1x"}));
+	// should cover every element once with a policy
+	std::vector<long> big(10000, 2);
+	std::atomic<long> total{0};
+	ccutl::iterate_it(ccutl::pool_par, ccutl::zip(big, big, big),
+										[&](auto it1, auto it2, auto it3) {
+											total += *it1 * *it2 * *it3;
+										});
+	EXPECT_EQ(total.load(), 80000L);
+}
+
+CCUTL_TEST(algorithm_n_combinations, general) {
+	// should be usable in constant expressions
+	static_assert(ccutl::n_combinations(52, 5) == 2598960);
+	EXPECT_EQ(ccutl::n_combinations(4, 0), 1U);
+	EXPECT_EQ(ccutl::n_combinations(4, 5), 0U);
+	// should be exact up to the largest representable central coefficient
+	EXPECT_EQ(ccutl::n_combinations(67, 33), 14226520737620288370ULL);
+	// should throw when the count does not fit in a size_t
+	EXPECT_THROW(ccutl::n_combinations(100, 50), const char *);
+	// should match the size of the combinate result
+	EXPECT_EQ(ccutl::n_combinations(7, 3),
+						ccutl::combinate(std::string("0123456"), 3).size());
+}
+
+CCUTL_TEST(algorithm_n_permutations, general) {
+	static_assert(ccutl::n_permutations(5) == 120);
+	static_assert(ccutl::n_permutations(5, 2) == 20);
+	static_assert(ccutl::n_permutations(5, 2, true) == 25);
+	EXPECT_EQ(ccutl::n_permutations(20), 2432902008176640000ULL);
+	EXPECT_EQ(ccutl::n_permutations(2, 63, true), size_t{1} << 63);
+	// should throw when the count does not fit in a size_t
+	EXPECT_THROW(ccutl::n_permutations(21), const char *);
+	EXPECT_THROW(ccutl::n_permutations(2, 64, true), const char *);
+}
+
+CCUTL_TEST(algorithm_combinate, general) {
+	// should produce combinations in lexicographic position order
+	EXPECT_EQ(ccutl::combinate(std::string("0123"), 2),
+						(std::vector<std::string>{"01", "02", "03", "12", "13", "23"}));
+	// should return the target itself for a full-size sample
+	EXPECT_EQ(ccutl::combinate(std::string("012"), 3),
+						(std::vector<std::string>{"012"}));
+	// should support non-random-access containers
+	EXPECT_EQ(ccutl::combinate(std::list<int>{1, 2, 3}, 2),
+						(std::vector<std::list<int>>{{1, 2}, {1, 3}, {2, 3}}));
+	// should snapshot non-trivially-copyable values by reference
+	std::list<std::string> words{"x", "yy", "zzz"};
+	EXPECT_EQ(ccutl::combinate(words, 2),
+						(std::vector<std::list<std::string>>{
+								{"x", "yy"}, {"x", "zzz"}, {"yy", "zzz"}}));
+	EXPECT_EQ(ccutl::permutate(words, 2),
+						(std::vector<std::list<std::string>>{{"x", "yy"},
+																								 {"yy", "x"},
+																								 {"x", "zzz"},
+																								 {"zzz", "x"},
+																								 {"yy", "zzz"},
+																								 {"zzz", "yy"}}));
+}
+
+CCUTL_TEST(algorithm_lazy_combinate, general) {
+	std::string target = "012345";
+	std::vector<std::string> lazy;
+	for (const auto &sample : ccutl::lazy_combinate(target, 4)) {
+		lazy.emplace_back(sample.begin(), sample.end());
+	}
+	// should match the materialized result
+	EXPECT_EQ(lazy, ccutl::combinate(target, 4));
+	// should visit exactly one combination for a full-size sample
+	size_t n_full = 0;
+	for (const auto &sample : ccutl::lazy_combinate(target, 6)) {
+		EXPECT_EQ(std::string(sample.begin(), sample.end()), target);
+		++n_full;
+	}
+	EXPECT_EQ(n_full, 1U);
+	// views should index the current sample
+	auto it = ccutl::lazy_combinate(target, 3).begin();
+	++it;
+	EXPECT_EQ((*it).size(), 3U);
+	EXPECT_EQ((*it)[2], '3');
+}
+
+CCUTL_TEST(algorithm_permutate, general) {
+	// should count with the first position moving fastest when repeating
+	EXPECT_EQ(ccutl::permutate(std::string("012"), 2, true),
+						(std::vector<std::string>{"00", "10", "20", "01", "11", "21",
+																			"02", "12", "22"}));
+	// should arrange every combination when not repeating
+	EXPECT_EQ(ccutl::permutate(std::string("012"), 2),
+						(std::vector<std::string>{"01", "10", "02", "20", "12", "21"}));
+	// should default to a full-size sample
+	EXPECT_EQ(ccutl::permutate(std::string("012")).size(), 6U);
+	// should allow samples larger than the target when repeating
+	EXPECT_EQ(ccutl::permutate(std::string("01"), 3, true).size(), 8U);
+}
+
+CCUTL_TEST(algorithm_lazy_permutate, general) {
+	std::list<int> target{1, 2, 3, 4};
+	for (bool repetition : {false, true}) {
+		std::vector<std::list<int>> lazy;
+		for (const auto &sample : ccutl::lazy_permutate(target, 3, repetition)) {
+			lazy.emplace_back(sample.begin(), sample.end());
+		}
+		// should match the materialized result
+		EXPECT_EQ(lazy, ccutl::permutate(target, 3, repetition));
+	}
+	// should never compare values
+	struct unordered {
+		int value;
+	};
+	std::vector<unordered> values{{3}, {1}, {2}, {1}};
+	std::vector<int> arranged;
+	for (const auto &sample : ccutl::lazy_permutate(values, 2)) {
+		arranged.push_back(sample[0].value * 10 + sample[1].value);
+	}
+	EXPECT_EQ(arranged, (std::vector<int>{31, 13, 32, 23, 31, 13, 12, 21, 11,
+																				11, 21, 12}));
+}
+
+CCUTL_TEST(algorithm_combination_rank, round_trip) {
+	std::string target = "0123456";
+	size_t rank = 0;
+	for (const auto &sample : ccutl::lazy_combinate(target, 3)) {
+		std::vector<size_t> positions;
+		for (char c : sample) positions.push_back(static_cast<size_t>(c - '0'));
+		// should rank in combinate order
+		EXPECT_EQ(ccutl::combination_rank(positions, target.size()), rank);
+		// should unrank to the same positions
+		EXPECT_EQ(ccutl::combination_unrank(rank, target.size(), 3), positions);
+		++rank;
+	}
+	// should resume a range from a rank
+	auto it = ccutl::lazy_combinate(target, 3).at(20);
+	EXPECT_EQ(std::string((*it).begin(), (*it).end()), "135");
+	// should round-trip the last rank of a large count
+	std::vector<size_t> last(20);
+	std::iota(last.begin(), last.end(), 40);
+	size_t n_total = ccutl::n_combinations(60, 20);
+	EXPECT_EQ(ccutl::combination_rank(last, 60), n_total - 1);
+	EXPECT_EQ(ccutl::combination_unrank(n_total - 1, 60, 20), last);
+	// should handle ranks that fit when C(n_avail, sample_sz) does not
+	std::vector<size_t> first(100);
+	std::iota(first.begin(), first.end(), 0);
+	EXPECT_THROW(ccutl::n_combinations(200, 100), const char *);
+	EXPECT_EQ(ccutl::combination_rank(first, 200), 0U);
+	EXPECT_EQ(ccutl::combination_unrank(0, 200, 100), first);
+	first.back() = 101;
+	EXPECT_EQ(ccutl::combination_rank(first, 200), 2U);
+	EXPECT_EQ(ccutl::combination_unrank(2, 200, 100), first);
+	first[98] = 100;
+	first.back() = 199;
+	EXPECT_EQ(ccutl::combination_rank(first, 200), 299U);
+	EXPECT_EQ(ccutl::combination_unrank(299, 200, 100), first);
+	// should throw if the rank itself does not fit
+	std::iota(first.begin(), first.end(), 1);
+	EXPECT_THROW(ccutl::combination_rank(first, 200), const char *);
+}
+
+CCUTL_TEST(algorithm_permutation_rank, round_trip) {
+	std::string target = "01234";
+	for (bool repetition : {false, true}) {
+		size_t rank = 0;
+		for (const auto &sample : ccutl::lazy_permutate(target, 3, repetition)) {
+			std::vector<size_t> positions;
+			for (char c : sample) positions.push_back(static_cast<size_t>(c - '0'));
+			// should rank in permutate order
+			EXPECT_EQ(ccutl::permutation_rank(positions, target.size(), repetition),
+								rank);
+			// should unrank to the same positions
+			EXPECT_EQ(ccutl::permutation_unrank(rank, target.size(), 3, repetition),
+								positions);
+			++rank;
+		}
+		// should resume a range from a rank
+		auto range = ccutl::lazy_permutate(target, 3, repetition);
+		size_t n_rest = 0;
+		for (auto it = range.at(rank - 7); it != range.end(); ++it) ++n_rest;
+		EXPECT_EQ(n_rest, 7U);
+	}
+	// should round-trip the last rank of a large count
+	std::vector<size_t> reversed(20);
+	std::iota(reversed.rbegin(), reversed.rend(), 0);
+	size_t n_total = ccutl::n_permutations(20, 20, false);
+	EXPECT_EQ(ccutl::permutation_rank(reversed, 20, false), n_total - 1);
+	EXPECT_EQ(ccutl::permutation_unrank(n_total - 1, 20, 20, false), reversed);
+	// should unrank without forming 25! (which does not fit in size_t)
+	std::vector<size_t> identity(25);
+	std::iota(identity.begin(), identity.end(), 0);
+	EXPECT_EQ(ccutl::permutation_unrank(0, 25, 25, false), identity);
+	std::swap(identity[23], identity[24]);
+	EXPECT_EQ(ccutl::permutation_unrank(1, 25, 25, false), identity);
+	size_t max_rank = std::numeric_limits<size_t>::max();
+	auto last_fit = ccutl::permutation_unrank(max_rank, 25, 25, false);
+	EXPECT_EQ(ccutl::permutation_rank(last_fit, 25, false), max_rank);
+	EXPECT_EQ(ccutl::permutation_rank(ccutl::permutation_unrank(max_rank, 30, 25),
+																		30),
+						max_rank);
+	// should throw if the rank does not fit
+	reversed.insert(reversed.begin(), 20);
+	EXPECT_THROW(ccutl::permutation_rank(reversed, 21, false), const char *);
+	std::vector<size_t> highest(20, 99);
+	EXPECT_THROW(ccutl::permutation_rank(highest, 100, true), const char *);
+	highest.resize(9);
+	EXPECT_EQ(ccutl::permutation_rank(highest, 100, true), 999999999999999999U);
+}
+
+CCUTL_TEST(algorithm_combinate, execution_policy) {
+	std::vector<int> target(12);
+	std::iota(target.begin(), target.end(), 0);
+	// should match the serial result
+	EXPECT_EQ(ccutl::combinate(std::execution::par, target, 5),
+						ccutl::combinate(target, 5));
+	EXPECT_EQ(ccutl::combinate(std::execution::seq, std::list<int>{3, 1, 2}, 2),
+						ccutl::combinate(std::list<int>{3, 1, 2}, 2));
+}
+
+CCUTL_TEST(algorithm_permutate, execution_policy) {
+	std::vector<int> target{4, 0, 3, 1, 2, 5, 6};
+	for (bool repetition : {false, true}) {
+		// should match the serial result
+		EXPECT_EQ(ccutl::permutate(std::execution::par, target, 4, repetition),
+							ccutl::permutate(target, 4, repetition));
+	}
+	// should produce every arrangement regardless of value order
+	EXPECT_EQ(ccutl::permutate(std::execution::par, target).size(), 5040U);
+}
+
+CCUTL_TEST(algorithm_for_each_combination, early_exit) {
+	std::string target = "abcdef";
+	size_t n_visited = 0;
+	// should stop as soon as the visitor returns false
+	bool completed = ccutl::for_each_combination(
+			target, 3, [&](const auto &sample) {
+				++n_visited;
+				return !(sample[0] == 'a' && sample[2] == 'f');
+			});
+	EXPECT_FALSE(completed);
+	EXPECT_EQ(n_visited, 4U);
+	// should visit everything with a void visitor
+	n_visited = 0;
+	EXPECT_TRUE(ccutl::for_each_combination(
+			target, 3, [&](const auto &) { ++n_visited; }));
+	EXPECT_EQ(n_visited, 20U);
+}
+
+CCUTL_TEST(algorithm_for_each_permutation, early_exit) {
+	std::list<int> target{1, 2, 3};
+	for (bool repetition : {false, true}) {
+		std::vector<std::list<int>> visited;
+		// should visit in permutate order until the visitor returns false
+		bool completed = ccutl::for_each_permutation(
+				target, 2, repetition, [&](const auto &sample) {
+					visited.emplace_back(sample.begin(), sample.end());
+					return visited.size() < 3;
+				});
+		EXPECT_FALSE(completed);
+		auto expected = ccutl::permutate(target, 2, repetition);
+		expected.resize(3);
+		EXPECT_EQ(visited, expected);
+	}
+}
+
+CCUTL_TEST(algorithm_revolving_door_combinate, minimal_change) {
+	std::string target = "0123456";
+	auto range = ccutl::revolving_door_combinate(target, 4);
+	std::vector<std::string> visited;
+	for (auto it = range.begin(); it != range.end(); ++it) {
+		std::string current((*it).begin(), (*it).end());
+		if (!visited.empty()) {
+			// should swap exactly one element per step
+			std::string expected = visited.back();
+			expected.erase(expected.find(static_cast<char>('0' + it.removed())), 1);
+			expected += static_cast<char>('0' + it.added());
+			std::sort(expected.begin(), expected.end());
+			EXPECT_EQ(current, expected);
+		}
+		visited.push_back(current);
+	}
+	// should visit every combination exactly once
+	std::sort(visited.begin(), visited.end());
+	EXPECT_EQ(visited, ccutl::combinate(target, 4));
+	// should step bidirectional targets in the same order
+	std::list<char> list_target(target.begin(), target.end());
+	auto range_it = range.begin();
+	size_t n_visited = 0;
+	for (const auto &sample : ccutl::revolving_door_combinate(list_target, 4)) {
+		EXPECT_TRUE(std::equal(sample.begin(), sample.end(), (*range_it).begin(),
+													 (*range_it).end()));
+		++range_it;
+		++n_visited;
+	}
+	EXPECT_EQ(n_visited, visited.size());
+	// should reject targets that cannot step backwards
+	EXPECT_TRUE(algorithm::can_revolve<std::list<char>>);
+	EXPECT_FALSE(algorithm::can_revolve<std::forward_list<char>>);
+}
+
+CCUTL_TEST(algorithm_swap_permutate, single_swaps) {
+	// unsorted, with a duplicate value
+	std::string target = "3103";
+	auto range = ccutl::swap_permutate(target);
+	std::vector<std::vector<size_t>> visited;
+	std::string previous = target;
+	for (auto it = range.begin(); it != range.end(); ++it) {
+		std::string current((*it).begin(), (*it).end());
+		// should differ from the previous permutation by the reported swap
+		std::swap(previous[it.swapped().first], previous[it.swapped().second]);
+		EXPECT_EQ(current, previous);
+		visited.push_back(it.positions());
+	}
+	// should visit all n! orderings of target positions
+	std::sort(visited.begin(), visited.end());
+	EXPECT_EQ(visited.size(), 24U);
+	EXPECT_EQ(std::unique(visited.begin(), visited.end()), visited.end());
+}
+
+CCUTL_TEST(algorithm_multiset_permutate, general) {
+	// should produce each distinct arrangement once, in sorted order
+	EXPECT_EQ(ccutl::multiset_permutate(std::string("aab")),
+						(std::vector<std::string>{"aab", "aba", "baa"}));
+	// should match a deduplicated permutate for any sample size
+	std::string target = "abcabca";
+	for (size_t sample_sz = 1; sample_sz <= target.size(); ++sample_sz) {
+		auto expected = ccutl::permutate(target, sample_sz);
+		std::sort(expected.begin(), expected.end());
+		expected.erase(std::unique(expected.begin(), expected.end()),
+									 expected.end());
+		auto distinct = ccutl::multiset_permutate(target, sample_sz);
+		// should reserve exactly the number of distinct arrangements
+		EXPECT_EQ(distinct.capacity(), expected.size());
+		std::sort(distinct.begin(), distinct.end());
+		EXPECT_EQ(distinct, expected);
+	}
+	// should support non-random-access containers
+	EXPECT_EQ(ccutl::multiset_permutate(std::list<int>{1, 2, 1}, 2),
+						(std::vector<std::list<int>>{{1, 1}, {1, 2}, {2, 1}}));
+}
+
+CCUTL_TEST(algorithm_combinate_mask, general) {
+	// should produce masks in combinate order
+	EXPECT_EQ(std::vector<uint64_t>(ccutl::combinate_mask(4, 2).begin(),
+																	ccutl::combinate_mask(4, 2).end()),
+						(std::vector<uint64_t>{0b0011, 0b0101, 0b1001, 0b0110, 0b1010,
+																	 0b1100}));
+	// should handle the full 64-bit universe
+	size_t n_masks = 0;
+	uint64_t last = 0;
+	for (uint64_t mask : ccutl::combinate_mask(64, 2)) {
+		last = mask;
+		++n_masks;
+	}
+	EXPECT_EQ(n_masks, 2016U);
+	EXPECT_EQ(last, uint64_t{3} << 62);
+	// should expand (lowest bit first) to the samples of combinate
+	std::vector<int> target(20);
+	std::iota(target.begin(), target.end(), 100);
+	std::vector<std::vector<int>> expanded;
+	for (uint64_t mask : ccutl::combinate_mask(20, 3)) {
+		auto &sample = expanded.emplace_back();
+		for (; mask != 0; mask &= mask - 1) {
+			sample.push_back(target[static_cast<size_t>(__builtin_ctzll(mask))]);
+		}
+	}
+	EXPECT_EQ(expanded, ccutl::combinate(target, 3));
+}
+
+CCUTL_TEST(algorithm_flat_samples, general) {
+	std::list<int> target{5, 3, 8, 1, 9, 2};
+	auto flat = ccutl::combinate_flat(target, 3);
+	auto nested = ccutl::combinate(target, 3);
+	// should store every combination contiguously with a fixed stride
+	ASSERT_EQ(flat.size(), nested.size());
+	EXPECT_EQ(flat.stride(), 3U);
+	EXPECT_EQ(flat[1].data(), flat.data() + 3);
+	for (size_t i = 0; i < flat.size(); ++i) {
+		EXPECT_EQ(std::list<int>(flat[i].begin(), flat[i].end()), nested[i]);
+	}
+	// should behave as a random-access range of rows
+	EXPECT_EQ(flat.end() - flat.begin(), static_cast<std::ptrdiff_t>(flat.size()));
+	EXPECT_EQ((*(flat.begin() + 4))[0], nested[4].front());
+	// should match the serial result with an execution policy
+	for (bool repetition : {false, true}) {
+		auto serial = ccutl::permutate_flat(target, 3, repetition);
+		auto parallel =
+				ccutl::permutate_flat(std::execution::par, target, 3, repetition);
+		EXPECT_EQ(serial.size(),
+							ccutl::permutate(target, 3, repetition).size());
+		EXPECT_TRUE(std::equal(serial.data(),
+													 serial.data() + serial.size() * serial.stride(),
+													 parallel.data()));
+	}
+	// should throw if the buffer size does not fit, even when the count does
+	std::vector<int> large(64);
+	EXPECT_NO_THROW(ccutl::n_combinations(large.size(), 32));
+	EXPECT_THROW(ccutl::combinate_flat(large, 32), const char *);
+	EXPECT_THROW(ccutl::flat_samples<int>(SIZE_MAX / 2, 3), const char *);
+}
+
+CCUTL_TEST(algorithm_combination_table, general) {
+	// should be computed at compile time
+	static constexpr auto table = ccutl::combination_table<8, 3>();
+	static_assert(table.size() == 56);
+	static_assert(table[0][0] == 0 && table[0][1] == 1 && table[0][2] == 2);
+	static_assert(table[55][0] == 5 && table[55][1] == 6 && table[55][2] == 7);
+	// should match the combinate order
+	std::vector<int> target{0, 1, 2, 3, 4, 5, 6, 7};
+	auto expected = ccutl::combinate(target, 3);
+	for (size_t i = 0; i < table.size(); ++i) {
+		EXPECT_EQ(std::vector<int>(table[i].begin(), table[i].end()), expected[i]);
+	}
+}
+
+CCUTL_TEST(algorithm_permutation_table, general) {
+	static constexpr auto table = ccutl::permutation_table<4, 2>();
+	static constexpr auto rep_table = ccutl::permutation_table<3, 2, true>();
+	static_assert(table.size() == 12 && rep_table.size() == 9);
+	static_assert(ccutl::permutation_table<4>().size() == 24);
+	// should match the permutate order
+	std::vector<int> target{0, 1, 2, 3};
+	auto expected = ccutl::permutate(target, 2);
+	for (size_t i = 0; i < table.size(); ++i) {
+		EXPECT_EQ(std::vector<int>(table[i].begin(), table[i].end()), expected[i]);
+	}
+	expected = ccutl::permutate(std::vector<int>{0, 1, 2}, 2, true);
+	for (size_t i = 0; i < rep_table.size(); ++i) {
+		EXPECT_EQ(std::vector<int>(rep_table[i].begin(), rep_table[i].end()),
+							expected[i]);
+	}
+}
+
+CCUTL_TEST(algorithm_sample_combinations, general) {
+	std::mt19937_64 rng(7);
+	std::string target = "abcde";
+	// should draw uniformly from every combination
+	std::map<std::string, size_t> n_draws;
+	for (const auto &sample : ccutl::sample_combinations(target, 2, 50000, rng)) {
+		++n_draws[sample];
+	}
+	ASSERT_EQ(n_draws.size(), 10U);
+	for (const auto &[sample, n] : n_draws) {
+		EXPECT_EQ(sample[0] < sample[1], true);
+		EXPECT_NEAR(static_cast<double>(n), 5000.0, 500.0);
+	}
+	// should cover the whole space once when every sample must be distinct
+	std::list<int> values{1, 2, 3, 4, 5, 6};
+	auto distinct = ccutl::sample_combinations(values, 3, 20, rng, true);
+	std::sort(distinct.begin(), distinct.end());
+	EXPECT_EQ(distinct, ccutl::combinate(values, 3));
+	// should not enumerate astronomically large spaces
+	std::vector<int> large(1000);
+	std::iota(large.begin(), large.end(), 0);
+	auto samples = ccutl::sample_combinations(large, 100, 10, rng, true);
+	EXPECT_EQ(samples.size(), 10U);
+	for (const auto &sample : samples) {
+		EXPECT_TRUE(std::is_sorted(sample.begin(), sample.end()));
+		EXPECT_EQ(std::adjacent_find(sample.begin(), sample.end()), sample.end());
+	}
+	auto arranged = ccutl::sample_permutations(large, 100, 10, rng);
+	for (auto sample : arranged) {
+		std::sort(sample.begin(), sample.end());
+		EXPECT_EQ(std::adjacent_find(sample.begin(), sample.end()), sample.end());
+	}
+	// should throw if there are not enough distinct samples
+	EXPECT_THROW(ccutl::sample_combinations(values, 3, 21, rng, true),
+							 const char *);
+	EXPECT_EQ(ccutl::sample_combinations(values, 3, 21, rng).size(), 21U);
+}
+
+CCUTL_TEST(algorithm_sample_permutations, general) {
+	std::mt19937_64 rng(11);
+	std::string target = "abcd";
+	for (bool repetition : {false, true}) {
+		// should draw uniformly from every permutation
+		std::map<std::string, size_t> n_draws;
+		for (const auto &sample :
+				 ccutl::sample_permutations(target, 2, 48000, rng, repetition)) {
+			++n_draws[sample];
+		}
+		size_t n_total = ccutl::n_permutations(4, 2, repetition);
+		ASSERT_EQ(n_draws.size(), n_total);
+		for (const auto &[sample, n] : n_draws) {
+			EXPECT_NEAR(static_cast<double>(n), 48000.0 / n_total, 400.0);
+		}
+		// should cover the whole space once when every sample must be distinct
+		auto distinct =
+				ccutl::sample_permutations(target, 2, n_total, rng, repetition, true);
+		auto expected = ccutl::permutate(target, 2, repetition);
+		std::sort(distinct.begin(), distinct.end());
+		std::sort(expected.begin(), expected.end());
+		EXPECT_EQ(distinct, expected);
+		// should throw if there are not enough distinct samples
+		EXPECT_THROW(ccutl::sample_permutations(target, 2, n_total + 1, rng,
+																						repetition, true),
+								 const char *);
+	}
+}
+
+CCUTL_TEST(algorithm_cartesian_product, general) {
+	std::vector<int> ints{1, 2};
+	std::string chars = "abc";
+	std::list<double> doubles{0.5};
+	auto product = ccutl::cartesian_product(ints, chars, doubles);
+	EXPECT_EQ(product.size(), 6U);
+	// should move the last container fastest and yield references
+	std::vector<std::tuple<int, char, double>> visited;
+	for (const auto &[i, c, d] : product) {
+		EXPECT_EQ(&d, &doubles.front());
+		visited.emplace_back(i, c, d);
+	}
+	EXPECT_EQ(visited,
+						(std::vector<std::tuple<int, char, double>>{{1, 'a', 0.5},
+																												{1, 'b', 0.5},
+																												{1, 'c', 0.5},
+																												{2, 'a', 0.5},
+																												{2, 'b', 0.5},
+																												{2, 'c', 0.5}}));
+	// should resume from a rank
+	EXPECT_EQ(std::get<1>(*product.at(4)), 'b');
+	// should be empty if any container is empty
+	std::vector<int> none;
+	auto empty = ccutl::cartesian_product(ints, none);
+	EXPECT_TRUE(empty.empty());
+	EXPECT_EQ(empty.begin() == empty.end(), true);
+	// should iterate products with more than 2^64 tuples
+	std::vector<int> wide(100000);
+	std::iota(wide.begin(), wide.end(), 0);
+	auto huge = ccutl::cartesian_product(wide, wide, wide, wide);
+	EXPECT_THROW(huge.size(), const char *);
+	EXPECT_FALSE(huge.empty());
+	auto it = huge.begin();
+	for (int i = 0; i < 100001; ++i) ++it;
+	EXPECT_EQ(*it, (std::tuple<const int &, const int &, const int &,
+														 const int &>(0, 0, 1, 1)));
+	EXPECT_EQ(it == huge.end(), false);
+}
+
+CCUTL_TEST(algorithm_cartesian_product, execution_policy) {
+	std::vector<int> xs(50);
+	std::iota(xs.begin(), xs.end(), 0);
+	std::list<int> ys{1, 10, 100};
+	std::string zs = "0123456789";
+	auto product = ccutl::cartesian_product(xs, ys, zs);
+	// should visit every tuple exactly once across threads
+	std::vector<std::atomic<int>> n_visits(product.size());
+	ccutl::for_each_product(std::execution::par, product, [&](const auto &t) {
+		size_t rank = static_cast<size_t>(std::get<0>(t)) * 30 +
+									static_cast<size_t>(std::distance(
+											ys.begin(), std::find(ys.begin(), ys.end(),
+																						std::get<1>(t)))) *
+											10 +
+									static_cast<size_t>(std::get<2>(t) - '0');
+		++n_visits[rank];
+	});
+	EXPECT_EQ(std::count(n_visits.begin(), n_visits.end(), 1), 1500);
+}
+
+CCUTL_TEST(algorithm_checkpoint, resume) {
+	std::list<int> target{1, 2, 3, 4, 5, 6, 7, 8};
+	auto combinations = ccutl::lazy_combinate(target, 3);
+	auto it = combinations.begin();
+	// should emit in bounded batches and resume after the last full batch
+	std::vector<std::list<int>> visited = ccutl::next_batch(combinations, &it, 20);
+	EXPECT_EQ(visited.size(), 20U);
+	std::vector<uint8_t> blob = combinations.checkpoint(it);
+	// should encode each ascending position in a single byte
+	EXPECT_EQ(blob.size(), 7U);
+	auto resumed = combinations.resume(blob);
+	while (resumed != combinations.end()) {
+		auto batch = ccutl::next_batch(combinations, &resumed, 20);
+		visited.insert(visited.end(), batch.begin(), batch.end());
+	}
+	EXPECT_EQ(visited, ccutl::combinate(target, 3));
+	// should restore a finished enumeration as the end iterator
+	EXPECT_EQ(combinations.resume(combinations.checkpoint(resumed)) ==
+								combinations.end(),
+						true);
+	// should reject blobs from a different enumeration
+	EXPECT_THROW(ccutl::lazy_combinate(target, 4).resume(blob), const char *);
+	EXPECT_THROW(ccutl::lazy_permutate(target, 3).resume(blob), const char *);
+	blob.pop_back();
+	EXPECT_THROW(combinations.resume(blob), const char *);
+
+	for (bool repetition : {false, true}) {
+		auto permutations = ccutl::lazy_permutate(target, 3, repetition);
+		auto pit = permutations.at(100);
+		auto resumed_pit = permutations.resume(permutations.checkpoint(pit));
+		// should restore the exact iterator state
+		EXPECT_EQ(resumed_pit.positions(), pit.positions());
+		EXPECT_EQ(ccutl::next_batch(permutations, &resumed_pit, 50),
+							ccutl::next_batch(permutations, &pit, 50));
+	}
+	// should batch every range that yields samples
+	auto doors = ccutl::revolving_door_combinate(target, 3);
+	auto dit = doors.begin();
+	EXPECT_EQ(ccutl::next_batch(doors, &dit, 100).size(), 56U);
+	auto swaps = ccutl::swap_permutate(target);
+	auto sit = swaps.begin();
+	EXPECT_EQ(ccutl::next_batch(swaps, &sit, 100).size(), 100U);
+	std::string letters = "abab";
+	auto distinct = ccutl::lazy_multiset_permutate(letters, 0);
+	auto mit = distinct.begin();
+	EXPECT_EQ(ccutl::next_batch(distinct, &mit, 100),
+						ccutl::multiset_permutate(letters));
+}
+
+CCUTL_TEST(algorithm_subsets, general) {
+	std::list<int> target{1, 2, 3, 4};
+	// should produce subsets by size, each size in combinate order
+	std::vector<std::vector<int>> visited;
+	for (const auto &sample : ccutl::subsets(target, 0, 2)) {
+		visited.emplace_back(sample.begin(), sample.end());
+	}
+	EXPECT_EQ(visited, (std::vector<std::vector<int>>{{},
+																										 {1},
+																										 {2},
+																										 {3},
+																										 {4},
+																										 {1, 2},
+																										 {1, 3},
+																										 {1, 4},
+																										 {2, 3},
+																										 {2, 4},
+																										 {3, 4}}));
+	// should match the masks of the bitmask fast path
+	std::vector<uint64_t> masks;
+	for (uint64_t mask : ccutl::subsets_mask(4, 0, 2)) masks.push_back(mask);
+	ASSERT_EQ(masks.size(), visited.size());
+	for (size_t i = 0; i < masks.size(); ++i) {
+		std::vector<int> members;
+		for (int bit = 0; bit < 4; ++bit) {
+			if (masks[i] >> bit & 1) members.push_back(bit + 1);
+		}
+		EXPECT_EQ(members, visited[i]);
+	}
+	// should cover the power set
+	auto power_set = ccutl::subsets(target, 0, 4);
+	EXPECT_EQ(power_set.size(), 16U);
+	size_t n_visited = 0;
+	for (auto it = power_set.begin(); it != power_set.end(); ++it) ++n_visited;
+	EXPECT_EQ(n_visited, 16U);
+	// should resume from a rank
+	auto it = ccutl::subsets(target, 1, 3).at(5);
+	EXPECT_EQ(std::vector<int>((*it).begin(), (*it).end()),
+						(std::vector<int>{1, 3}));
+}
+
+CCUTL_TEST(algorithm_subsets, execution_policy) {
+	std::vector<int> target(16);
+	std::iota(target.begin(), target.end(), 0);
+	// should visit every subset exactly once across threads
+	std::vector<std::atomic<int>> n_visits(size_t{1} << target.size());
+	ccutl::for_each_subset(std::execution::par, ccutl::subsets(target, 2, 14),
+												 [&](const auto &sample) {
+													 size_t mask = 0;
+													 for (int v : sample) mask |= size_t{1} << v;
+													 ++n_visits[mask];
+												 });
+	EXPECT_EQ(std::count(n_visits.begin(), n_visits.end(), 1),
+						(1 << 16) - 1 - 16 - 16 - 1);
+	EXPECT_EQ(std::count(n_visits.begin(), n_visits.end(), 0), 1 + 16 + 16 + 1);
+}
+
+}	// namespace ccutl_tests
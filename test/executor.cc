@@ -0,0 +1,112 @@
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file test/executor.cc
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Tests the functions of ccutl/executor.h.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <list>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ccutl_test.h"
+
+#include "ccutl/algorithm.h"
+#include "ccutl/executor.h"
+
+namespace ccutl_tests {
+
+CCUTL_TEST(executor_work_stealing_pool, general) {
+	ccutl::work_stealing_pool pool(3);
+	EXPECT_EQ(pool.size(), 3U);
+	// should visit every index exactly once
+	std::vector<std::atomic<int>> visits(10007);
+	pool.parallel_for(visits.size(), [&](size_t first, size_t last) {
+		for (size_t i = first; i < last; ++i) ++visits[i];
+	});
+	for (const auto &v : visits) EXPECT_EQ(v.load(), 1);
+	// should run submitted tasks
+	std::promise<int> result;
+	pool.submit([&] { result.set_value(42); });
+	EXPECT_EQ(result.get_future().get(), 42);
+	// should not deadlock when nested
+	std::atomic<size_t> n_inner{0};
+	pool.parallel_for(8, [&](size_t first, size_t last) {
+		for (size_t i = first; i < last; ++i) {
+			pool.parallel_for(100, [&](size_t a, size_t b) { n_inner += b - a; });
+		}
+	});
+	EXPECT_EQ(n_inner.load(), 800U);
+	// should rethrow the exception of a failed chunk after the others finish
+	EXPECT_THROW(pool.parallel_for(100,
+																 [](size_t first, size_t) {
+																	 if (first == 0) throw "EFail";
+																 }),
+							 const char *);
+	// should sleep rather than spin while chunks run on other threads
+	auto caller = std::this_thread::get_id();
+	std::clock_t cpu_start = std::clock();
+	pool.parallel_for(8, [&](size_t, size_t) {
+		if (std::this_thread::get_id() != caller) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(300));
+		}
+	});
+	double cpu_ms = 1000.0 * static_cast<double>(std::clock() - cpu_start) /
+									CLOCKS_PER_SEC;
+	EXPECT_LT(cpu_ms, 100.0);
+}
+
+CCUTL_TEST(executor_pool_policy, algorithm) {
+	ccutl::work_stealing_pool pool(2, true);
+	std::vector<int> input(5000);
+	std::iota(input.begin(), input.end(), 0);
+	// should be accepted by the *_it algorithms
+	std::vector<int> doubled{-1};
+	auto end = ccutl::transform_it<true>(pool.policy(), input, &doubled,
+																			 [](int v) { return v * 2; });
+	EXPECT_EQ(end, doubled.end());
+	EXPECT_EQ(doubled.size(), 5001U);
+	EXPECT_EQ(doubled[5000], 9998);
+	std::vector<int> sums(input.size());
+	ccutl::transform_it(ccutl::pool_par, input, input, &sums,
+											[](int a, int b) { return a + b; });
+	EXPECT_EQ(sums, std::vector<int>(doubled.begin() + 1, doubled.end()));
+	std::atomic<long> total{0};
+	ccutl::for_each_it(pool.policy(), std::list<int>(input.begin(), input.end()),
+										 [&](int v) { total += v; });
+	EXPECT_EQ(total.load(), 5000L * 4999 / 2);
+	ccutl::for_each_it(pool.policy(), std::list<int>{}, [&](int v) { total += v; });
+	EXPECT_EQ(total.load(), 5000L * 4999 / 2);
+	// should be accepted by the chunked enumeration algorithms
+	std::string target = "abcdefghij";
+	EXPECT_EQ(ccutl::combinate(pool.policy(), target, 4),
+						ccutl::combinate(target, 4));
+	EXPECT_EQ(ccutl::permutate(ccutl::pool_par, target, 3),
+						ccutl::permutate(target, 3));
+}
+
+}	// namespace ccutl_tests
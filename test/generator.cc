@@ -0,0 +1,97 @@
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file test/generator.cc
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Tests the functions of ccutl/generator.h.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "ccutl_test.h"
+
+#include "ccutl/algorithm.h"
+#include "ccutl/generator.h"
+
+#ifdef CCUTL_HAS_COROUTINES
+
+namespace ccutl_tests {
+
+namespace generator {
+ccutl::generator<int> count_to(int n) {
+	for (int i = 0; i < n; ++i) co_yield i;
+}
+
+ccutl::generator<int> squares(ccutl::generator<int> input) {
+	for (int v : input) co_yield v * v;
+}
+
+ccutl::generator<int> fail_after(int n) {
+	for (int i = 0; i < n; ++i) co_yield i;
+	throw "EFail";
+}
+}	// namespace generator
+
+CCUTL_TEST(generator_generator, general) {
+	// should compose generators lazily
+	std::vector<int> visited;
+	for (int v : generator::squares(generator::count_to(4))) visited.push_back(v);
+	EXPECT_EQ(visited, (std::vector<int>{0, 1, 4, 9}));
+	// should rethrow exceptions from the coroutine
+	std::vector<int> before_throw;
+	EXPECT_THROW(
+			for (int v : generator::fail_after(2)) before_throw.push_back(v),
+			const char *);
+	EXPECT_EQ(before_throw, (std::vector<int>{0, 1}));
+}
+
+CCUTL_TEST(generator_co_combinate, general) {
+	std::list<int> target{1, 2, 3, 4, 5};
+	std::vector<std::list<int>> visited;
+	for (const auto &sample : ccutl::co_combinate(target, 3)) {
+		visited.push_back(sample);
+	}
+	// should match combinate
+	EXPECT_EQ(visited, ccutl::combinate(target, 3));
+	// should stop early without enumerating the rest
+	auto combinations = ccutl::co_combinate(std::string("abcdef"), 2);
+	auto it = combinations.begin();
+	EXPECT_EQ(*it, "ab");
+	++it;
+	EXPECT_EQ(*it, "ac");
+}
+
+CCUTL_TEST(generator_co_permutate, general) {
+	std::string target = "0123";
+	for (bool repetition : {false, true}) {
+		std::vector<std::string> visited;
+		for (const auto &sample : ccutl::co_permutate(target, 2, repetition)) {
+			visited.push_back(sample);
+		}
+		// should match permutate, including the repetition counting mode
+		EXPECT_EQ(visited, ccutl::permutate(target, 2, repetition));
+	}
+}
+
+}	// namespace ccutl_tests
+
+#endif	// CCUTL_HAS_COROUTINES
@@ -23,12 +23,14 @@
  * @copyright Copyright (c) 2019 Justin Collier
  */
 
+#include <cstdint>
 #include <limits>
 #include <string>
 
 #include "ccutl_test.h"
 
 #include "ccutl/limits.h"
+#include "ccutl/math.h"
 
 namespace ccutl_tests {
 
@@ -38,6 +40,7 @@ static constexpr uint uint_max = ccutl::max_v<uint>;
 static constexpr float float_max = ccutl::max_v<float>;
 static constexpr int int_min = ccutl::min_v<int>;
 static constexpr float float_min = ccutl::min_v<float>;
+static constexpr int64_t int64_min = ccutl::min_v<int64_t>;
 }	// namespace limits
 
 CCUTL_TEST(limits_max_v, general) {
@@ -185,4 +188,68 @@ CCUTL_TEST(limits_is_sub_overflow, float_general_cases) {
 
 #undef LIMITS_SUB_OVERFLOW
 
+#ifndef LIMITS_IS_MUL_OVERFLOW
+#define LIMITS_IS_MUL_OVERFLOW(a, b, type, expected)         \
+	{                                                          \
+		ASSERT_EQ(ccutl::is_mul_overflow<type>(a, b), expected); \
+		ASSERT_EQ(ccutl::is_mul_overflow<type>(b, a), expected); \
+	}
+#endif
+
+CCUTL_TEST(limits_is_mul_overflow, signed_edge_cases) {
+	LIMITS_IS_MUL_OVERFLOW(0, 0, int, false);
+	LIMITS_IS_MUL_OVERFLOW(0, limits::int_min, int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_max, 1, int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_max, -1, int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_max, 2, int, true);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_min, 1, int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_min, -1, int, true);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_min / 2, 2, int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::int_min / 2, -2, int, true);
+}
+
+CCUTL_TEST(limits_is_mul_overflow, signed_general_cases) {
+	LIMITS_IS_MUL_OVERFLOW(46340, 46340, int, false);
+	LIMITS_IS_MUL_OVERFLOW(46341, 46341, int, true);
+	LIMITS_IS_MUL_OVERFLOW(-46340, 46340, int, false);
+	LIMITS_IS_MUL_OVERFLOW(-46341, -46341, int, true);
+}
+
+CCUTL_TEST(limits_is_mul_overflow, unsigned_limits) {
+	LIMITS_IS_MUL_OVERFLOW(0, -1, u_int, false);
+	LIMITS_IS_MUL_OVERFLOW(1, -1, u_int, true);
+	LIMITS_IS_MUL_OVERFLOW(-1, -1, u_int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::uint_max, 1U, u_int, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::uint_max, 2U, u_int, true);
+}
+
+CCUTL_TEST(limits_is_mul_overflow, unsigned_arguments) {
+	LIMITS_IS_MUL_OVERFLOW(limits::uint_max, 1U, int, true);
+	LIMITS_IS_MUL_OVERFLOW(limits::uint_max, 0U, int, false);
+	LIMITS_IS_MUL_OVERFLOW(2U, -3, int, false);
+}
+
+CCUTL_TEST(limits_is_mul_overflow, float_cases) {
+	LIMITS_IS_MUL_OVERFLOW(0, 0, float, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::float_max, 1, float, false);
+	LIMITS_IS_MUL_OVERFLOW(limits::float_max, 2, float, true);
+	LIMITS_IS_MUL_OVERFLOW(limits::float_max, -2, float, true);
+	LIMITS_IS_MUL_OVERFLOW(limits::float_max / 2, 2, float, false);
+}
+
+#undef LIMITS_IS_MUL_OVERFLOW
+
+CCUTL_TEST(limits_safe_mul, mixed_signedness) {
+	// should not overflow an intermediate type when the product fits
+	EXPECT_EQ(ccutl::safe_mul<uint64_t>(uint64_t{1} << 62, 2),
+						uint64_t{1} << 63);
+	EXPECT_EQ(ccutl::safe_mul<int64_t>(uint64_t{1} << 63, int64_t{-1}),
+						limits::int64_min);
+	EXPECT_EQ(ccutl::safe_mul<int>(2U, -3), -6);
+	EXPECT_EQ(ccutl::safe_mul<uint16_t>(uint16_t{255}, 257), uint16_t{65535});
+	EXPECT_EQ(ccutl::safe_mul<double>(3U, -1.5), -4.5);
+	EXPECT_THROW(ccutl::safe_mul<uint64_t>(uint64_t{1} << 63, 2), const char *);
+	EXPECT_THROW(ccutl::safe_mul<int64_t>(uint64_t{1} << 63, 1), const char *);
+}
+
 }	// namespace ccutl_tests
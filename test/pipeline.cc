@@ -0,0 +1,150 @@
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file test/pipeline.cc
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Tests the functions of ccutl/pipeline.h.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <atomic>
+#include <execution>
+#include <list>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ccutl_test.h"
+
+#include "ccutl/executor.h"
+#include "ccutl/pipeline.h"
+
+namespace ccutl_tests {
+
+CCUTL_TEST(pipeline_pipe, general) {
+	std::list<int> input{1, 2, 3, 4, 5, 6};
+	// should run every stage per value, in order, changing types as it goes
+	std::vector<std::string> result{"first"};
+	std::vector<int> visited;
+	size_t n_appended =
+			ccutl::pipe(input) | ccutl::map([&](int v) {
+				visited.push_back(v);
+				return v * 10;
+			}) |
+			ccutl::filter([](int v) { return v % 20 == 0; }) |
+			ccutl::map([](int v) { return std::to_string(v); }) |
+			ccutl::into(&result);
+	EXPECT_EQ(n_appended, 3U);
+	EXPECT_EQ(result, (std::vector<std::string>{"first", "20", "40", "60"}));
+	EXPECT_EQ(visited, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+	// should copy the input without stages
+	std::vector<int> copied;
+	EXPECT_EQ(ccutl::pipe(input) | ccutl::into(&copied), 6U);
+	EXPECT_EQ(copied, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+	// should be reusable
+	auto evens = ccutl::pipe(input) |
+							 ccutl::filter([](int v) { return v % 2 == 0; });
+	std::string digits;
+	evens | ccutl::map([](int v) { return static_cast<char>('0' + v); }) |
+			ccutl::into(&digits);
+	evens | ccutl::map([](int v) { return static_cast<char>('0' + v); }) |
+			ccutl::into(&digits);
+	EXPECT_EQ(digits, "246246");
+}
+
+CCUTL_TEST(pipeline_pipe, execution_policy) {
+	std::vector<int> input(10007);
+	std::iota(input.begin(), input.end(), 0);
+	auto square = ccutl::map([](int v) { return static_cast<long>(v) * v; });
+	auto odd = ccutl::filter([](long v) { return v % 2 == 1; });
+	std::vector<long> expected{-1};
+	ccutl::pipe(input) | square | odd | ccutl::into(&expected);
+	std::vector<long> expected_all{-1};
+	ccutl::pipe(input) | square | ccutl::into(&expected_all);
+	// should keep the input order with filters (block buffers) and without
+	// (output slots), for std policies and pools
+	std::vector<long> par{-1};
+	EXPECT_EQ(ccutl::pipe(std::execution::par, input) | square | odd |
+								ccutl::into(&par),
+						5003U);
+	EXPECT_EQ(par, expected);
+	std::vector<long> par_all{-1};
+	EXPECT_EQ(ccutl::pipe(std::execution::par_unseq, input) | square |
+								ccutl::into(&par_all),
+						10007U);
+	EXPECT_EQ(par_all, expected_all);
+	ccutl::work_stealing_pool pool(3);
+	std::vector<long> pooled{-1};
+	ccutl::pipe(pool.policy(), input) | square | odd | ccutl::into(&pooled);
+	EXPECT_EQ(pooled, expected);
+	std::vector<long> pooled_all{-1};
+	ccutl::pipe(ccutl::pool_par, input) | square | ccutl::into(&pooled_all);
+	EXPECT_EQ(pooled_all, expected_all);
+	// should keep the order across rounds of blocks (each at most 16384 values
+	// per chunk) and append to non-random-access outputs
+	std::vector<int> large(1000003);
+	std::iota(large.begin(), large.end(), 0);
+	auto thirds = ccutl::filter([](int v) { return v % 3 == 0; });
+	std::list<int> expected_large{-1};
+	ccutl::pipe(large) | thirds | ccutl::into(&expected_large);
+	std::list<int> pooled_large{-1};
+	EXPECT_EQ(ccutl::pipe(pool.policy(), large) | thirds |
+								ccutl::into(&pooled_large),
+						333335U);
+	EXPECT_EQ(pooled_large, expected_large);
+	std::list<int> par_large{-1};
+	ccutl::pipe(std::execution::par, large) | ccutl::into(&par_large);
+	EXPECT_EQ(par_large.size(), large.size() + 1);
+	EXPECT_EQ(par_large.back(), 1000002);
+	// should visit every value once
+	std::atomic<size_t> n_visited{0};
+	std::vector<int> none;
+	ccutl::pipe(pool.policy(), input) | ccutl::filter([&](int) {
+		++n_visited;
+		return false;
+	}) | ccutl::into(&none);
+	EXPECT_EQ(n_visited.load(), input.size());
+	EXPECT_TRUE(none.empty());
+}
+
+namespace pipeline {
+template <typename TPolicy, typename TInput, typename = void>
+inline constexpr bool can_pipe = false;
+
+template <typename TPolicy, typename TInput>
+inline constexpr bool can_pipe<
+		TPolicy, TInput,
+		std::void_t<decltype(ccutl::pipe(std::declval<TPolicy>(),
+																		 std::declval<const TInput &>()))>> = true;
+}	// namespace pipeline
+
+CCUTL_TEST(pipeline_pipe, random_access) {
+	using par_t = std::execution::parallel_policy;
+	using seq_t = std::execution::sequenced_policy;
+	// should only run in parallel over random-access inputs
+	EXPECT_TRUE((pipeline::can_pipe<const par_t &, std::vector<int>>));
+	EXPECT_TRUE((pipeline::can_pipe<ccutl::pool_policy, std::string>));
+	EXPECT_FALSE((pipeline::can_pipe<const par_t &, std::list<int>>));
+	EXPECT_FALSE((pipeline::can_pipe<ccutl::pool_policy, std::list<int>>));
+	EXPECT_TRUE((pipeline::can_pipe<const seq_t &, std::list<int>>));
+}
+
+}	// namespace ccutl_tests
@@ -0,0 +1,215 @@
+/*
+	Copyright (c) 2019 Justin Collier
+	This program is free software: you can redistribute it and/or modify it under
+	the terms of the GNU General Public License as published by the Free Software
+	foundation, either version 3 of the License, or (at your option) any later
+	version.
+	This program is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+	FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+	details.
+	You should have received a copy of the GNU General Public License along with
+	this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file test/simd.cc
+ * @author Justin Collier (jpcxist@gmail.com)
+ * @brief Tests the functions of ccutl/simd.h.
+ * @version 0.1.0
+ * @since cpputils 0.5.0
+ * @date created 2026-10-17
+ * @date modified 2026-10-17
+ * @copyright Copyright (c) 2019 Justin Collier
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <vector>
+
+#include "ccutl_test.h"
+
+#include "ccutl/algorithm.h"
+#include "ccutl/executor.h"
+#include "ccutl/simd.h"
+
+namespace ccutl_tests {
+
+namespace simd {
+template <typename T>
+std::vector<T> iota(size_t n, T first, T step) {
+	std::vector<T> result(n);
+	for (size_t i = 0; i < n; ++i) {
+		result[i] = static_cast<T>(first + static_cast<T>(i) * step);
+	}
+	return result;
+}
+
+// results of the SIMD path (ccutl::ops) vs std::transform with a lambda
+template <typename T, typename TOp, typename TReference>
+void expect_binary(const TOp &op, const TReference &reference) {
+	// odd sizes exercise the scalar tail of every vector width
+	for (size_t n : {size_t{0}, size_t{1}, size_t{7}, size_t{16}, size_t{33},
+									 size_t{1000}, size_t{1031}}) {
+		auto a = iota<T>(n, static_cast<T>(-50), static_cast<T>(3));
+		auto b = iota<T>(n, static_cast<T>(20), static_cast<T>(-1));
+		std::vector<T> expected(n);
+		std::transform(a.begin(), a.end(), b.begin(), expected.begin(), reference);
+		std::vector<T> result(n);
+		ccutl::transform_it(a, b, &result, op);
+		EXPECT_EQ(result, expected);
+	}
+}
+}	// namespace simd
+
+CCUTL_TEST(simd_simd_width, general) {
+	size_t width = ccutl::simd_width();
+	EXPECT_TRUE(width == 16 || width == 32 || width == 64);
+}
+
+CCUTL_TEST(simd_transform_it, binary) {
+	simd::expect_binary<float>(ccutl::ops::add{},
+														 [](float a, float b) { return a + b; });
+	simd::expect_binary<double>(ccutl::ops::sub{},
+															[](double a, double b) { return a - b; });
+	simd::expect_binary<int32_t>(ccutl::ops::mul{},
+															 [](int32_t a, int32_t b) { return a * b; });
+	simd::expect_binary<int8_t>(ccutl::ops::add{}, [](int8_t a, int8_t b) {
+		return static_cast<int8_t>(a + b);
+	});
+	simd::expect_binary<float>(ccutl::ops::min{}, [](float a, float b) {
+		return std::min(a, b);
+	});
+	simd::expect_binary<uint64_t>(ccutl::ops::max{}, [](uint64_t a, uint64_t b) {
+		return std::max(a, b);
+	});
+	// should recognize the std functors
+	simd::expect_binary<double>(std::plus<>{},
+															[](double a, double b) { return a + b; });
+	simd::expect_binary<int16_t>(std::multiplies<int16_t>{},
+															 [](int16_t a, int16_t b) {
+																 return static_cast<int16_t>(a * b);
+															 });
+}
+
+CCUTL_TEST(simd_transform_it, unary) {
+	auto input = simd::iota<float>(1001, -500.5F, 1.0F);
+	std::vector<float> result(input.size());
+	// should append with BackInsert
+	std::vector<float> abs{1.0F};
+	ccutl::transform_it<true>(input, &abs, ccutl::ops::abs{});
+	EXPECT_EQ(abs.size(), 1002U);
+	EXPECT_EQ(abs[1], 500.5F);
+	EXPECT_EQ(abs[1001], 499.5F);
+	// should compute a * mul + add
+	ccutl::transform_it(input, &result, ccutl::ops::fma<float>{2.0F, 1.0F});
+	EXPECT_EQ(result[0], -1000.0F);
+	EXPECT_EQ(result[1000], 1000.0F);
+	// should convert between lane types
+	std::vector<int32_t> truncated(input.size());
+	ccutl::transform_it(input, &truncated, ccutl::ops::cast<int32_t>{});
+	EXPECT_EQ(truncated[0], -500);
+	EXPECT_EQ(truncated[1000], 499);
+	std::array<double, 5> widened{};
+	ccutl::transform_it(std::array<int8_t, 5>{-2, -1, 0, 1, 2}, &widened,
+											ccutl::ops::cast<double>{});
+	EXPECT_EQ(widened, (std::array<double, 5>{-2, -1, 0, 1, 2}));
+	// should work in place
+	ccutl::transform_it(result, &result, ccutl::ops::abs{});
+	EXPECT_EQ(result[0], 1000.0F);
+	// should fall back to std::transform for other containers
+	std::list<float> listed(input.begin(), input.end());
+	std::vector<float> from_list;
+	ccutl::transform_it<true>(listed, &from_list, ccutl::ops::abs{});
+	EXPECT_EQ(from_list, std::vector<float>(abs.begin() + 1, abs.end()));
+	// should wrap signed integer lanes like the truncated scalar result
+	auto bytes = simd::iota<int8_t>(1031, INT8_MIN, 1);
+	std::vector<int8_t> byte_abs(bytes.size());
+	ccutl::transform_it(bytes, &byte_abs, ccutl::ops::abs{});
+	EXPECT_EQ(byte_abs[0], INT8_MIN);
+	EXPECT_EQ(byte_abs[1], INT8_MAX);
+	auto shorts = simd::iota<int16_t>(1031, -500, 1);
+	std::vector<int16_t> scaled(shorts.size());
+	ccutl::transform_it(shorts, &scaled, ccutl::ops::fma<int16_t>{300, 7});
+	for (size_t i = 0; i < shorts.size(); ++i) {
+		EXPECT_EQ(scaled[i], static_cast<int16_t>(shorts[i] * 300 + 7));
+	}
+}
+
+CCUTL_TEST(simd_transform_it, wrapping_tail) {
+	// should wrap overflowing int32 / int64 values in the scalar tail (1031 is
+	// not a multiple of any lane count) as in the vector body
+	EXPECT_EQ(ccutl::ops::abs{}(INT32_MIN), INT32_MIN);
+	EXPECT_EQ(ccutl::ops::add{}(INT64_MAX, int64_t{1}), INT64_MIN);
+	std::vector<int32_t> ints(1031, INT32_MIN);
+	std::vector<int32_t> ints_abs(ints.size());
+	ccutl::transform_it(ints, &ints_abs, ccutl::ops::abs{});
+	EXPECT_EQ(ints_abs, ints);
+	std::vector<int32_t> ints_fma(ints.size());
+	ccutl::transform_it(ints, &ints_fma, ccutl::ops::fma<int32_t>{-1, -1});
+	EXPECT_EQ(ints_fma, std::vector<int32_t>(ints.size(), INT32_MAX));
+	std::vector<int64_t> longs(1031, INT64_MAX);
+	std::vector<int64_t> ones(longs.size(), 1);
+	std::vector<int64_t> sums(longs.size());
+	ccutl::transform_it(longs, ones, &sums, ccutl::ops::add{});
+	EXPECT_EQ(sums, std::vector<int64_t>(longs.size(), INT64_MIN));
+	std::vector<int64_t> squares(longs.size());
+	ccutl::transform_it(longs, longs, &squares, ccutl::ops::mul{});
+	EXPECT_EQ(squares, std::vector<int64_t>(longs.size(), 1));
+	std::vector<uint16_t> halves(1031, UINT16_MAX);
+	std::vector<uint16_t> half_squares(halves.size());
+	ccutl::transform_it(halves, halves, &half_squares, ccutl::ops::mul{});
+	EXPECT_EQ(half_squares, std::vector<uint16_t>(halves.size(), 1));
+}
+
+CCUTL_TEST(simd_transform_it, fma_rounding) {
+	ccutl::ops::fma<float> op{1.1F, -0.3F};
+	auto input = simd::iota<float>(1031, 0.37F, 0.1F);
+	// should differ from a * mul + add rounded twice for some values
+	size_t n_unfused = 0;
+	for (float a : input) {
+		volatile float product = a * op.mul;
+		n_unfused += product + op.add != std::fma(a, op.mul, op.add);
+	}
+	EXPECT_GT(n_unfused, 0U);
+	// should round once on every path, whatever the length (odd lengths and
+	// uneven chunks end in scalar tails)
+	for (size_t n : {size_t{1}, size_t{7}, size_t{15}, size_t{33}, size_t{1031}}) {
+		std::vector<float> in(input.begin(),
+													input.begin() + static_cast<std::ptrdiff_t>(n));
+		std::vector<float> expected(n);
+		for (size_t i = 0; i < n; ++i) {
+			expected[i] = std::fma(in[i], op.mul, op.add);
+		}
+		std::vector<float> vectorized;
+		ccutl::transform_it<true>(in, &vectorized, op);
+		EXPECT_EQ(vectorized, expected);
+		std::list<float> listed(in.begin(), in.end());
+		std::vector<float> scalar;
+		ccutl::transform_it<true>(listed, &scalar, op);
+		EXPECT_EQ(scalar, expected);
+		std::vector<float> pooled;
+		ccutl::transform_it<true>(ccutl::pool_par, in, &pooled, op);
+		EXPECT_EQ(pooled, expected);
+	}
+}
+
+CCUTL_TEST(simd_transform_it, pool_policy) {
+	auto a = simd::iota<double>(100003, 0.0, 0.5);
+	auto b = simd::iota<double>(100003, 7.0, 0.25);
+	std::vector<double> serial;
+	ccutl::transform_it<true>(a, b, &serial, ccutl::ops::max{});
+	// should use the same kernels for each chunk
+	std::vector<double> pooled;
+	ccutl::transform_it<true>(ccutl::pool_par, a, b, &pooled, ccutl::ops::max{});
+	EXPECT_EQ(pooled, serial);
+	EXPECT_EQ(pooled[0], 7.0);
+	EXPECT_EQ(pooled[100002], 50001.0);
+}
+
+}	// namespace ccutl_tests